@@ -0,0 +1,455 @@
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+#include "BinaryRaportSink.hpp"
+#include "Factory.hpp"
+#include "FactoryEdit.hpp"
+#include "LoadingRamp.hpp"
+#include "NullRaportSink.hpp"
+#include "Random.hpp"
+#include "StaticFactory.hpp"
+#include "StoreHouse.hpp"
+#include "StructureFile.hpp"
+#include "TextRaportSink.hpp"
+#include "TopologyGenerator.hpp"
+#include "Utils.hpp"
+#include "Worker.hpp"
+
+namespace
+{
+    constexpr size_t ticksPerIteration = 16;
+    constexpr size_t warmUpTicks = 200;
+    constexpr int64_t minNodesCount = 1'000;
+    constexpr int64_t maxNodesCount = 1'000'000;
+    constexpr size_t staticChainWorkersCount = 32;
+    constexpr size_t staticRunTicks = 1'000;
+    constexpr size_t latencyRunTicks = 200;
+
+    constexpr auto createStaticChain()
+    {
+        sd::StaticStructure<1, staticChainWorkersCount, 1, staticChainWorkersCount + 1> structure{};
+        structure.loadingRamps[0] = {1, 2};
+        structure.storeHouses[0] = {1};
+        for (size_t id = 1; id <= staticChainWorkersCount; ++id)
+        {
+            structure.workers[id - 1] = {id, 1 + id % 2, sd::WorkerType::FIFO};
+            const sd::LinkBind source = id == 1 ? sd::LinkBind{1, sd::NodeType::RAMP}
+                                                : sd::LinkBind{id - 1, sd::NodeType::WORKER};
+            structure.links[id - 1] = {id, 1, source, {id, sd::NodeType::WORKER}};
+        }
+        structure.links[staticChainWorkersCount] = {
+            staticChainWorkersCount + 1, 1, {staticChainWorkersCount, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}};
+        return structure;
+    }
+
+    constexpr auto staticChain = createStaticChain();
+
+    sd::Factory::Ptr createFactory(sd::Topology topology, size_t nodesCount)
+    {
+        auto factory = std::make_unique<sd::Factory>(sd::TopologyGenerator{}.generate(topology, nodesCount));
+        factory->setContext(std::make_shared<sd::SimulationContext>(std::make_unique<sd::SeededRandomDevice>(1)));
+        factory->validate();
+        return factory;
+    }
+
+    void runTicks(sd::Factory &factory, size_t &time, size_t ticks)
+    {
+        std::ostream nullStream{nullptr};
+        sd::RunOptions options;
+        options.startTime = time;
+        time += ticks;
+        factory.run(time, nullStream, {size_t{0}}, options);
+    }
+
+    void setNodesCounter(benchmark::State &state, size_t nodesCount)
+    {
+        state.counters["nodes"] = static_cast<double>(nodesCount);
+    }
+
+    void BM_Parse(benchmark::State &state, sd::Topology topology)
+    {
+        const auto nodesCount = static_cast<size_t>(state.range(0));
+        std::stringstream structure;
+        structure << *createFactory(topology, nodesCount);
+        const auto text = structure.str();
+
+        for (auto _ : state)
+        {
+            std::stringstream in{text};
+            sd::Factory factory;
+            in >> factory;
+            benchmark::DoNotOptimize(factory);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * text.size()));
+        setNodesCounter(state, nodesCount);
+    }
+
+    void BM_LoadBinary(benchmark::State &state, sd::Topology topology)
+    {
+        const auto nodesCount = static_cast<size_t>(state.range(0));
+        std::stringstream structure;
+        sd::StructureFile::write(structure, createFactory(topology, nodesCount)->getStructure());
+        const auto data = structure.str();
+
+        for (auto _ : state)
+        {
+            std::stringstream in{data};
+            sd::Factory factory{sd::StructureFile::read(in)};
+            benchmark::DoNotOptimize(factory);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+        setNodesCounter(state, nodesCount);
+    }
+
+    void BM_RunTick(benchmark::State &state, sd::Topology topology)
+    {
+        const auto nodesCount = static_cast<size_t>(state.range(0));
+        auto factory = createFactory(topology, nodesCount);
+        size_t time = 0;
+        runTicks(*factory, time, warmUpTicks);
+
+        for (auto _ : state)
+        {
+            runTicks(*factory, time, ticksPerIteration);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ticksPerIteration));
+        setNodesCounter(state, nodesCount);
+    }
+
+    void BM_RemoveWorkers(benchmark::State &state, sd::Topology topology)
+    {
+        constexpr size_t removedWorkersStep = 50;
+        const auto nodesCount = static_cast<size_t>(state.range(0));
+
+        size_t removed = 0;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto factory = createFactory(topology, nodesCount);
+            auto workers = factory->getWorkersData();
+            state.ResumeTiming();
+            for (size_t index = 0; index < workers.size(); index += removedWorkersStep)
+            {
+                factory->removeWorker(workers[index].id);
+                ++removed;
+            }
+            state.PauseTiming();
+            factory.reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(removed));
+        setNodesCounter(state, nodesCount);
+    }
+
+    // a single ramp fanning out to every worker, all of them feeding one storehouse
+    sd::FactoryStructure createHub(size_t workersCount)
+    {
+        sd::FactoryStructure structure{{{1, 1}}, {}, {{1}}, {}};
+        for (size_t id = 1; id <= workersCount; ++id)
+        {
+            structure.workers.push_back({id, 1, sd::WorkerType::FIFO});
+            structure.links.push_back({2 * id - 1, 1, {1, sd::NodeType::RAMP}, {id, sd::NodeType::WORKER}});
+            structure.links.push_back({2 * id, 1, {id, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+        }
+        return structure;
+    }
+
+    void BM_HubBuild(benchmark::State &state, bool useEdit)
+    {
+        const auto structure = createHub(static_cast<size_t>(state.range(0)));
+        for (auto _ : state)
+        {
+            sd::Factory factory;
+            if (useEdit)
+            {
+                auto edit = factory.edit();
+                for (auto &data : structure.loadingRamps)
+                {
+                    edit.addLoadingRamp(data);
+                }
+                for (auto &data : structure.workers)
+                {
+                    edit.addWorker(data);
+                }
+                for (auto &data : structure.storeHouses)
+                {
+                    edit.addStorehouse(data);
+                }
+                for (auto &data : structure.links)
+                {
+                    edit.addLink(data);
+                }
+                edit.commit();
+            }
+            else
+            {
+                for (auto &data : structure.loadingRamps)
+                {
+                    factory.addLoadingRamp(data);
+                }
+                for (auto &data : structure.workers)
+                {
+                    factory.addWorker(data);
+                }
+                for (auto &data : structure.storeHouses)
+                {
+                    factory.addStorehouse(data);
+                }
+                for (auto &data : structure.links)
+                {
+                    factory.addLink(data);
+                }
+            }
+            benchmark::DoNotOptimize(factory);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * structure.links.size()));
+    }
+
+    void BM_HubRemove(benchmark::State &state, bool useEdit)
+    {
+        const auto workersCount = static_cast<size_t>(state.range(0));
+        const auto structure = createHub(workersCount);
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto factory = std::make_unique<sd::Factory>(structure);
+            state.ResumeTiming();
+            if (useEdit)
+            {
+                auto edit = factory->edit();
+                for (size_t id = 2; id <= workersCount; id += 2)
+                {
+                    edit.removeWorker(id);
+                }
+                edit.commit();
+            }
+            else
+            {
+                for (size_t id = 2; id <= workersCount; id += 2)
+                {
+                    factory->removeWorker(id);
+                }
+            }
+            state.PauseTiming();
+            factory.reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (workersCount / 2)));
+    }
+
+    void BM_NodeTick(benchmark::State &state)
+    {
+        const auto workersCount = static_cast<size_t>(state.range(0));
+        sd::LoadingRamp ramp{1, 1};
+        sd::StoreHouse store{1};
+        std::vector<std::unique_ptr<sd::Worker>> workers;
+        std::deque<sd::Link> links;
+        sd::SourceNode *source = &ramp;
+        for (size_t id = 1; id <= workersCount; ++id)
+        {
+            auto &worker = *workers.emplace_back(std::make_unique<sd::Worker>(id, sd::WorkerType::FIFO, 1 + id % 3));
+            auto &link = links.emplace_back(id, 1, *source, worker);
+            source->bindSourceLink(link);
+            worker.bindDestinationLink(link);
+            source = &worker;
+        }
+        auto &link = links.emplace_back(workersCount + 1, 1, *source, store);
+        source->bindSourceLink(link);
+        store.bindDestinationLink(link);
+
+        size_t time = 0;
+        for (auto _ : state)
+        {
+            ramp.process(time);
+            ramp.passProduct();
+            for (auto &worker : workers)
+            {
+                worker->passProduct();
+            }
+            for (auto &worker : workers)
+            {
+                worker->process(time);
+            }
+            while (store.areProductsAvailable())
+            {
+                store.getStoredProduct();
+            }
+            ++time;
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+        setNodesCounter(state, workersCount + 2);
+    }
+
+    void BM_StaticChainRun(benchmark::State &state)
+    {
+        std::ostream nullStream{nullptr};
+        sd::SeededRandomDevice randomDevice{1};
+        auto factory = std::make_unique<sd::StaticFactory<staticChain>>();
+        for (auto _ : state)
+        {
+            factory->reset();
+            factory->run(staticRunTicks, nullStream, {size_t{0}}, randomDevice);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * staticRunTicks));
+    }
+
+    void BM_FactoryChainRun(benchmark::State &state)
+    {
+        std::ostream nullStream{nullptr};
+        auto structure = sd::StaticFactory<staticChain>::getStructure();
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            sd::Factory factory{structure};
+            factory.setContext(std::make_shared<sd::SimulationContext>(std::make_unique<sd::SeededRandomDevice>(1)));
+            state.ResumeTiming();
+            factory.run(staticRunTicks, nullStream, {size_t{0}});
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * staticRunTicks));
+    }
+
+    void BM_LatencyRun(benchmark::State &state, bool trackLatency)
+    {
+        const auto nodesCount = static_cast<size_t>(state.range(0));
+        std::ostream nullStream{nullptr};
+        sd::RunOptions options;
+        options.trackLatency = trackLatency;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto factory = createFactory(sd::Topology::MESH, nodesCount);
+            state.ResumeTiming();
+            factory->run(latencyRunTicks, nullStream, {size_t{0}}, options);
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * latencyRunTicks));
+        setNodesCounter(state, nodesCount);
+    }
+
+    template <class Buffer>
+    void runSinkStateRaport(benchmark::State &state, sd::Topology topology, Buffer &buffer, sd::IRaportSink &sink)
+    {
+        const auto nodesCount = static_cast<size_t>(state.range(0));
+        auto factory = createFactory(topology, nodesCount);
+        size_t time = 0;
+        runTicks(*factory, time, warmUpTicks);
+
+        size_t bytes = 0;
+        for (auto _ : state)
+        {
+            buffer.clear();
+            factory->writeStateRaport(sink);
+            bytes += buffer.size();
+            benchmark::DoNotOptimize(buffer.data());
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(bytes));
+        setNodesCounter(state, nodesCount);
+    }
+
+    void BM_TextSinkStateRaport(benchmark::State &state, sd::Topology topology)
+    {
+        std::string buffer;
+        sd::TextRaportSink sink{buffer};
+        runSinkStateRaport(state, topology, buffer, sink);
+    }
+
+    void BM_BinarySinkStateRaport(benchmark::State &state, sd::Topology topology)
+    {
+        std::vector<uint8_t> buffer;
+        sd::BinaryRaportSink sink{buffer};
+        runSinkStateRaport(state, topology, buffer, sink);
+    }
+
+    void BM_NullSinkStateRaport(benchmark::State &state, sd::Topology topology)
+    {
+        std::string buffer;
+        sd::NullRaportSink sink;
+        runSinkStateRaport(state, topology, buffer, sink);
+    }
+
+    void BM_StructureRaport(benchmark::State &state, sd::Topology topology)
+    {
+        const auto nodesCount = static_cast<size_t>(state.range(0));
+        auto factory = createFactory(topology, nodesCount);
+
+        size_t bytes = 0;
+        for (auto _ : state)
+        {
+            auto raport = factory->generateStructureRaport();
+            bytes += raport.size();
+            benchmark::DoNotOptimize(raport);
+        }
+        state.SetBytesProcessed(static_cast<int64_t>(bytes));
+        setNodesCounter(state, nodesCount);
+    }
+
+    void registerBenchmarks()
+    {
+        const std::vector<std::pair<std::string, void (*)(benchmark::State &, sd::Topology)>> benchmarks = {
+            {"Parse", &BM_Parse},
+            {"LoadBinary", &BM_LoadBinary},
+            {"RunTick", &BM_RunTick},
+            {"RemoveWorkers", &BM_RemoveWorkers},
+            {"TextSinkStateRaport", &BM_TextSinkStateRaport},
+            {"BinarySinkStateRaport", &BM_BinarySinkStateRaport},
+            {"NullSinkStateRaport", &BM_NullSinkStateRaport},
+            {"StructureRaport", &BM_StructureRaport},
+        };
+        const std::vector<sd::Topology> topologies = {sd::Topology::CHAIN, sd::Topology::FAN_OUT,
+                                                      sd::Topology::MESH, sd::Topology::SELF_LOOP};
+        for (auto &[name, function] : benchmarks)
+        {
+            for (auto topology : topologies)
+            {
+                benchmark::RegisterBenchmark((name + "/" + sd::toString(topology)).c_str(), function, topology)
+                    ->RangeMultiplier(10)
+                    ->Range(minNodesCount, maxNodesCount)
+                    ->Unit(benchmark::kMillisecond);
+            }
+        }
+        benchmark::RegisterBenchmark("NodeTick", &BM_NodeTick)->RangeMultiplier(8)->Range(8, 512);
+        for (auto useEdit : {false, true})
+        {
+            std::string suffix = useEdit ? "/Edit" : "/Direct";
+            benchmark::RegisterBenchmark(("HubBuild" + suffix).c_str(), &BM_HubBuild, useEdit)
+                ->RangeMultiplier(4)
+                ->Range(1'024, 16'384)
+                ->Unit(benchmark::kMillisecond);
+            benchmark::RegisterBenchmark(("HubRemove" + suffix).c_str(), &BM_HubRemove, useEdit)
+                ->RangeMultiplier(4)
+                ->Range(1'024, 16'384)
+                ->Unit(benchmark::kMillisecond);
+        }
+        benchmark::RegisterBenchmark("ChainRun/Static", &BM_StaticChainRun)->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark("ChainRun/Factory", &BM_FactoryChainRun)->Unit(benchmark::kMicrosecond);
+        for (auto trackLatency : {false, true})
+        {
+            std::string suffix = trackLatency ? "/On" : "/Off";
+            benchmark::RegisterBenchmark(("LatencyRun" + suffix).c_str(), &BM_LatencyRun, trackLatency)
+                ->Arg(10'000)
+                ->Unit(benchmark::kMillisecond);
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string jsonFormat = "--benchmark_format=json";
+    std::vector<char *> arguments{argv, argv + argc};
+    arguments.insert(arguments.begin() + 1, jsonFormat.data());
+    auto argumentsCount = static_cast<int>(arguments.size());
+
+    registerBenchmarks();
+    benchmark::Initialize(&argumentsCount, arguments.data());
+    if (benchmark::ReportUnrecognizedArguments(argumentsCount, arguments.data()))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
\ No newline at end of file
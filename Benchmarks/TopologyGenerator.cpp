@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "TopologyGenerator.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        constexpr size_t minNodesCount = 3;
+        constexpr size_t workersPerStoreHouse = 100;
+    } // namespace
+
+    TopologyGenerator::TopologyGenerator(uint64_t seed) : _eng(seed)
+    {
+    }
+
+    FactoryStructure TopologyGenerator::generate(Topology topology, size_t nodesCount)
+    {
+        if (nodesCount < minNodesCount)
+        {
+            throw std::runtime_error("Topology requires at least 3 nodes");
+        }
+        _structure = {};
+        _nextLinkId = 1;
+        switch (topology)
+        {
+        case Topology::CHAIN:
+            generateChain(nodesCount);
+            break;
+        case Topology::FAN_OUT:
+            generateFanOut(nodesCount);
+            break;
+        case Topology::MESH:
+            generateMesh(nodesCount);
+            break;
+        case Topology::SELF_LOOP:
+            generateSelfLoops(nodesCount);
+            break;
+        }
+        return std::move(_structure);
+    }
+
+    void TopologyGenerator::generateChain(size_t nodesCount)
+    {
+        _structure.loadingRamps.push_back({1, 1});
+        auto store = addStoreHouses(1);
+        LinkBind previous{1, NodeType::RAMP};
+        for (size_t index = 0; index < nodesCount - 2; ++index)
+        {
+            auto worker = addWorker(1);
+            addLink(previous, {worker, NodeType::WORKER});
+            previous = {worker, NodeType::WORKER};
+        }
+        addLink(previous, {store, NodeType::STORE});
+    }
+
+    void TopologyGenerator::generateFanOut(size_t nodesCount)
+    {
+        auto rampsCount = std::max<size_t>(1, nodesCount / (FanOutWidth + 1));
+        auto storesCount = std::max<size_t>(1, nodesCount / workersPerStoreHouse);
+        auto workersCount = nodesCount - rampsCount - storesCount;
+        auto firstStore = addStoreHouses(storesCount);
+        for (size_t ramp = 1; ramp <= rampsCount; ++ramp)
+        {
+            _structure.loadingRamps.push_back({ramp, 1});
+        }
+        for (size_t index = 0; index < workersCount; ++index)
+        {
+            auto worker = addWorker(FanOutWidth / 4);
+            addLink({index % rampsCount + 1, NodeType::RAMP}, {worker, NodeType::WORKER});
+            addLink({worker, NodeType::WORKER}, {firstStore + index % storesCount, NodeType::STORE});
+        }
+    }
+
+    void TopologyGenerator::generateMesh(size_t nodesCount)
+    {
+        auto rampsCount = std::min(MeshWidth, (nodesCount - 1) / 2);
+        auto workersCount = nodesCount - rampsCount - 1;
+        auto store = addStoreHouses(1);
+        for (size_t ramp = 1; ramp <= rampsCount; ++ramp)
+        {
+            _structure.loadingRamps.push_back({ramp, 4});
+        }
+        for (size_t index = 0; index < workersCount; ++index)
+        {
+            addWorker(3);
+        }
+        for (size_t index = 0; index < workersCount; ++index)
+        {
+            LinkBind worker{index + 1, NodeType::WORKER};
+            if (index < MeshWidth)
+            {
+                addLink({index % rampsCount + 1, NodeType::RAMP}, worker);
+            }
+            auto nextLayer = (index / MeshWidth + 1) * MeshWidth;
+            if (nextLayer >= workersCount)
+            {
+                addLink(worker, {store, NodeType::STORE});
+                continue;
+            }
+            auto nextLayerEnd = std::min(nextLayer + MeshWidth, workersCount);
+            if (index + MeshWidth < workersCount)
+            {
+                addLink(worker, {index + MeshWidth + 1, NodeType::WORKER});
+            }
+            for (size_t degree = 1; degree < MeshDegree; ++degree)
+            {
+                addLink(worker, {random(nextLayer, nextLayerEnd - 1) + 1, NodeType::WORKER});
+            }
+        }
+    }
+
+    void TopologyGenerator::generateSelfLoops(size_t nodesCount)
+    {
+        auto rampsCount = std::max<size_t>(1, nodesCount / (SelfLoopSegment * 2));
+        auto storesCount = std::max<size_t>(1, nodesCount / (SelfLoopSegment * 4));
+        auto workersCount = nodesCount - rampsCount - storesCount;
+        auto firstStore = addStoreHouses(storesCount);
+        for (size_t ramp = 1; ramp <= rampsCount; ++ramp)
+        {
+            _structure.loadingRamps.push_back({ramp, 8});
+        }
+        for (size_t index = 0; index < workersCount; ++index)
+        {
+            auto worker = addWorker(2);
+            auto segment = index / SelfLoopSegment;
+            if (index % SelfLoopSegment == 0)
+            {
+                addLink({segment % rampsCount + 1, NodeType::RAMP}, {worker, NodeType::WORKER});
+            }
+            addLink({worker, NodeType::WORKER}, {worker, NodeType::WORKER});
+            if ((index + 1) % SelfLoopSegment == 0 || index + 1 == workersCount)
+            {
+                addLink({worker, NodeType::WORKER}, {firstStore + segment % storesCount, NodeType::STORE});
+            }
+            else
+            {
+                addLink({worker, NodeType::WORKER}, {worker + 1, NodeType::WORKER});
+            }
+        }
+    }
+
+    size_t TopologyGenerator::addWorker(size_t maxProcessingTime)
+    {
+        auto id = _structure.workers.size() + 1;
+        auto type = random(0, 1) ? WorkerType::FIFO : WorkerType::LIFO;
+        _structure.workers.push_back({id, random(1, std::max<size_t>(maxProcessingTime, 1)), type});
+        return id;
+    }
+
+    size_t TopologyGenerator::addStoreHouses(size_t count)
+    {
+        auto first = _structure.storeHouses.size() + 1;
+        for (size_t index = 0; index < count; ++index)
+        {
+            _structure.storeHouses.push_back({first + index});
+        }
+        return first;
+    }
+
+    void TopologyGenerator::addLink(LinkBind source, LinkBind destination)
+    {
+        auto probability = static_cast<double>(random(1, 10)) / 10;
+        _structure.links.push_back({_nextLinkId++, probability, source, destination});
+    }
+
+    size_t TopologyGenerator::random(size_t min, size_t max)
+    {
+        return std::uniform_int_distribution<size_t>{min, max}(_eng);
+    }
+
+    std::string toString(Topology topology)
+    {
+        switch (topology)
+        {
+        case Topology::CHAIN:
+            return "chain";
+        case Topology::FAN_OUT:
+            return "fan_out";
+        case Topology::MESH:
+            return "mesh";
+        case Topology::SELF_LOOP:
+            return "self_loop";
+        }
+        return "";
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "FactoryStructure.hpp"
+
+namespace sd
+{
+    enum class Topology
+    {
+        CHAIN,
+        FAN_OUT,
+        MESH,
+        SELF_LOOP
+    };
+
+    class TopologyGenerator
+    {
+      private:
+        std::mt19937_64 _eng;
+        FactoryStructure _structure;
+        size_t _nextLinkId = 1;
+
+      public:
+        static constexpr size_t FanOutWidth = 256;
+        static constexpr size_t MeshWidth = 32;
+        static constexpr size_t MeshDegree = 8;
+        static constexpr size_t SelfLoopSegment = 64;
+
+        TopologyGenerator(uint64_t seed = 1);
+
+        FactoryStructure generate(Topology topology, size_t nodesCount);
+
+      private:
+        void generateChain(size_t nodesCount);
+        void generateFanOut(size_t nodesCount);
+        void generateMesh(size_t nodesCount);
+        void generateSelfLoops(size_t nodesCount);
+
+        size_t addWorker(size_t maxProcessingTime);
+        size_t addStoreHouses(size_t count);
+        void addLink(LinkBind source, LinkBind destination);
+
+        size_t random(size_t min, size_t max);
+    };
+
+    std::string toString(Topology topology);
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "AliasTable.hpp"
+
+namespace sd
+{
+    size_t AliasTable::sample(double propability) const
+    {
+        const auto count = _probabilities.size();
+        const auto scaled = propability * static_cast<double>(count);
+        auto column = static_cast<size_t>(scaled);
+        if (column >= count)
+        {
+            column = count - 1;
+        }
+        return scaled - static_cast<double>(column) < _probabilities[column] ? column : _aliases[column];
+    }
+
+    size_t AliasTable::size() const
+    {
+        return _probabilities.size();
+    }
+
+    bool AliasTable::empty() const
+    {
+        return _probabilities.empty();
+    }
+} // namespace sd
\ No newline at end of file
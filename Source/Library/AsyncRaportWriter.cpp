@@ -0,0 +1,132 @@
+#include <stdexcept>
+#include <string>
+
+#include "AsyncRaportWriter.hpp"
+#include "TextRaportSink.hpp"
+
+namespace sd
+{
+    AsyncRaportWriter::AsyncRaportWriter(std::ostream &out, size_t capacity) : _out(&out), _capacity(capacity)
+    {
+        start();
+    }
+
+    AsyncRaportWriter::AsyncRaportWriter(IRaportSink &sink, size_t capacity) : _sink(&sink), _capacity(capacity)
+    {
+        start();
+    }
+
+    void AsyncRaportWriter::start()
+    {
+        if (_capacity == 0)
+        {
+            throw std::runtime_error("Raport writer capacity must be positive");
+        }
+        _thread = std::thread{&AsyncRaportWriter::work, this};
+    }
+
+    AsyncRaportWriter::~AsyncRaportWriter()
+    {
+        {
+            std::lock_guard lock{_mutex};
+            _stopping = true;
+        }
+        _changed.notify_all();
+        _thread.join();
+    }
+
+    RaportSnapshot AsyncRaportWriter::acquire()
+    {
+        std::lock_guard lock{_mutex};
+        if (_free.empty())
+        {
+            return {};
+        }
+        auto snapshot = std::move(_free.back());
+        _free.pop_back();
+        snapshot.clear();
+        return snapshot;
+    }
+
+    void AsyncRaportWriter::submit(RaportSnapshot &&snapshot)
+    {
+        std::unique_lock lock{_mutex};
+        _changed.wait(lock, [this] { return _inFlight < _capacity || _error; });
+        checkError();
+        _pending.push_back(std::move(snapshot));
+        ++_inFlight;
+        lock.unlock();
+        _changed.notify_all();
+    }
+
+    void AsyncRaportWriter::flush()
+    {
+        std::unique_lock lock{_mutex};
+        _changed.wait(lock, [this] { return _inFlight == 0; });
+        checkError();
+        if (_out)
+        {
+            _out->flush();
+        }
+    }
+
+    size_t AsyncRaportWriter::getCapacity() const
+    {
+        return _capacity;
+    }
+
+    void AsyncRaportWriter::work()
+    {
+        std::string buffer;
+        TextRaportSink textSink{buffer};
+        std::unique_lock lock{_mutex};
+        while (true)
+        {
+            _changed.wait(lock, [this] { return _stopping || !_pending.empty(); });
+            if (_pending.empty())
+            {
+                return;
+            }
+            auto snapshot = std::move(_pending.front());
+            _pending.pop_front();
+            auto failed = bool{_error};
+            lock.unlock();
+
+            if (!failed)
+            {
+                try
+                {
+                    if (_sink)
+                    {
+                        snapshot.replay(*_sink);
+                    }
+                    else
+                    {
+                        buffer.clear();
+                        snapshot.replay(textSink);
+                        _out->write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                    }
+                }
+                catch (...)
+                {
+                    lock.lock();
+                    _error = std::current_exception();
+                    lock.unlock();
+                }
+            }
+
+            lock.lock();
+            _free.push_back(std::move(snapshot));
+            --_inFlight;
+            _changed.notify_all();
+        }
+    }
+
+    void AsyncRaportWriter::checkError()
+    {
+        if (_error)
+        {
+            std::rethrow_exception(_error);
+        }
+    }
+} // namespace sd
\ No newline at end of file
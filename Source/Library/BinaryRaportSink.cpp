@@ -0,0 +1,257 @@
+#include <bit>
+#include <format>
+
+#include "BinaryRaportSink.hpp"
+#include "EventTrace.hpp"
+#include "LatencyTracker.hpp"
+#include "QueueSummary.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        class RecordReader
+        {
+          private:
+            const uint8_t *_in;
+            const uint8_t *_end;
+
+          public:
+            RecordReader(const std::vector<uint8_t> &data) : _in(data.data()), _end(data.data() + data.size())
+            {
+            }
+
+            bool empty() const
+            {
+                return _in == _end;
+            }
+
+            uint8_t readByte()
+            {
+                return *_in++;
+            }
+
+            uint64_t readVarint()
+            {
+                uint64_t value;
+                _in = EventTrace::readVarint(_in, _end, value);
+                return value;
+            }
+
+            std::string_view readText()
+            {
+                auto size = readVarint();
+                if (size > static_cast<uint64_t>(_end - _in))
+                {
+                    throw std::runtime_error("Raport contains truncated text");
+                }
+                std::string_view text{reinterpret_cast<const char *>(_in), size};
+                _in += size;
+                return text;
+            }
+        };
+    } // namespace
+
+    BinaryRaportSink::BinaryRaportSink(std::vector<uint8_t> &out) : _out(out)
+    {
+    }
+
+    void BinaryRaportSink::beginRaport(size_t time, bool delta)
+    {
+        writeRecord(RAPORT, {time, delta});
+    }
+
+    void BinaryRaportSink::beginSection(std::string_view title)
+    {
+        writeRecord(SECTION, {});
+        writeText(title);
+    }
+
+    void BinaryRaportSink::beginNode(size_t offset, NodeType type, size_t id)
+    {
+        writeRecord(NODE, {offset, static_cast<uint64_t>(type), id});
+    }
+
+    void BinaryRaportSink::writeProperty(size_t offset, std::string_view name, size_t value)
+    {
+        writeRecord(NUMBER_PROPERTY, {offset});
+        writeText(name);
+        writeVarint(value);
+    }
+
+    void BinaryRaportSink::writeProperty(size_t offset, std::string_view name, std::string_view value)
+    {
+        writeRecord(TEXT_PROPERTY, {offset});
+        writeText(name);
+        writeText(value);
+    }
+
+    void BinaryRaportSink::beginLinks(size_t offset)
+    {
+        writeRecord(LINKS, {offset});
+    }
+
+    void BinaryRaportSink::writeLink(size_t offset, NodeType type, size_t id, double probability)
+    {
+        writeRecord(LINK, {offset, static_cast<uint64_t>(type), id, std::bit_cast<uint64_t>(probability)});
+    }
+
+    void BinaryRaportSink::beginQueue(size_t offset)
+    {
+        writeRecord(QUEUE, {offset});
+    }
+
+    void BinaryRaportSink::writeCurrentProduct(uint64_t id, size_t processingTime)
+    {
+        writeRecord(CURRENT_PRODUCT, {id, processingTime});
+    }
+
+    void BinaryRaportSink::writeProduct(uint64_t id)
+    {
+        writeRecord(PRODUCT, {id});
+    }
+
+    void BinaryRaportSink::writeQueueSummary(size_t offset, const QueueSummary &summary, size_t listedProducts)
+    {
+        writeRecord(QUEUE_SUMMARY, {offset, listedProducts, summary.length, summary.oldestProduct,
+                                    summary.newestProduct, summary.ageP50, summary.ageP90, summary.ageP99});
+    }
+
+    void BinaryRaportSink::endNode()
+    {
+        writeRecord(END_NODE, {});
+    }
+
+    void BinaryRaportSink::beginLatencyRaport()
+    {
+        writeRecord(LATENCY_RAPORT, {});
+    }
+
+    void BinaryRaportSink::writeLatency(size_t offset, std::string_view name, const LatencyStatistic &statistic)
+    {
+        writeRecord(LATENCY, {offset});
+        writeText(name);
+        for (auto value : {statistic.count, statistic.sum, statistic.max})
+        {
+            writeVarint(value);
+        }
+    }
+
+    void BinaryRaportSink::replay(const std::vector<uint8_t> &data, IRaportSink &sink)
+    {
+        RecordReader reader{data};
+        while (!reader.empty())
+        {
+            switch (auto record = reader.readByte())
+            {
+            case SECTION:
+                sink.beginSection(reader.readText());
+                break;
+            case NODE:
+            {
+                auto offset = reader.readVarint();
+                auto type = static_cast<NodeType>(reader.readVarint());
+                sink.beginNode(offset, type, reader.readVarint());
+                break;
+            }
+            case NUMBER_PROPERTY:
+            {
+                auto offset = reader.readVarint();
+                auto name = reader.readText();
+                sink.writeProperty(offset, name, size_t{reader.readVarint()});
+                break;
+            }
+            case TEXT_PROPERTY:
+            {
+                auto offset = reader.readVarint();
+                auto name = reader.readText();
+                sink.writeProperty(offset, name, reader.readText());
+                break;
+            }
+            case LINKS:
+                sink.beginLinks(reader.readVarint());
+                break;
+            case LINK:
+            {
+                auto offset = reader.readVarint();
+                auto type = static_cast<NodeType>(reader.readVarint());
+                auto id = reader.readVarint();
+                sink.writeLink(offset, type, id, std::bit_cast<double>(reader.readVarint()));
+                break;
+            }
+            case QUEUE:
+                sink.beginQueue(reader.readVarint());
+                break;
+            case CURRENT_PRODUCT:
+            {
+                auto id = reader.readVarint();
+                sink.writeCurrentProduct(id, reader.readVarint());
+                break;
+            }
+            case PRODUCT:
+                sink.writeProduct(reader.readVarint());
+                break;
+            case END_NODE:
+                sink.endNode();
+                break;
+            case RAPORT:
+            {
+                auto time = reader.readVarint();
+                sink.beginRaport(time, reader.readVarint() != 0);
+                break;
+            }
+            case QUEUE_SUMMARY:
+            {
+                auto offset = reader.readVarint();
+                auto listedProducts = reader.readVarint();
+                QueueSummary summary;
+                summary.length = reader.readVarint();
+                summary.oldestProduct = reader.readVarint();
+                summary.newestProduct = reader.readVarint();
+                summary.ageP50 = reader.readVarint();
+                summary.ageP90 = reader.readVarint();
+                summary.ageP99 = reader.readVarint();
+                sink.writeQueueSummary(offset, summary, listedProducts);
+                break;
+            }
+            case LATENCY_RAPORT:
+                sink.beginLatencyRaport();
+                break;
+            case LATENCY:
+            {
+                auto offset = reader.readVarint();
+                auto name = reader.readText();
+                LatencyStatistic statistic;
+                statistic.count = reader.readVarint();
+                statistic.sum = reader.readVarint();
+                statistic.max = reader.readVarint();
+                sink.writeLatency(offset, name, statistic);
+                break;
+            }
+            default:
+                throw std::runtime_error(std::format("Raport contains unknown record {}", int{record}));
+            }
+        }
+    }
+
+    void BinaryRaportSink::writeRecord(Record record, std::initializer_list<uint64_t> values)
+    {
+        _out.push_back(record);
+        for (auto value : values)
+        {
+            writeVarint(value);
+        }
+    }
+
+    void BinaryRaportSink::writeVarint(uint64_t value)
+    {
+        uint8_t buffer[EventTrace::MaxVarintSize];
+        _out.insert(_out.end(), buffer, EventTrace::writeVarint(buffer, value));
+    }
+
+    void BinaryRaportSink::writeText(std::string_view text)
+    {
+        writeVarint(text.size());
+        _out.insert(_out.end(), text.begin(), text.end());
+    }
+} // namespace sd
\ No newline at end of file
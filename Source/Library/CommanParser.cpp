@@ -27,6 +27,90 @@ namespace sd
 
         _app->add_option("-m,--maxIterations", _results.maxIterations, "Maximum iteration that simulation will be run");
 
+        _app->add_option("-e,--engine", _results.runOptions.engine,
+                         "Simulation engine: tick - iterates every node each tick, event - jumps between events, "
+                         "parallel - splits workers between threads each tick, "
+                         "flat - runs compiled structure-of-arrays kernel")
+            ->transform(CLI::CheckedTransformer(
+                std::map<std::string, SimulationEngine>{{"tick", SimulationEngine::TICK},
+                                                        {"event", SimulationEngine::EVENT},
+                                                        {"parallel", SimulationEngine::PARALLEL},
+                                                        {"flat", SimulationEngine::FLAT}},
+                CLI::ignore_case));
+
+        _app->add_option("-j,--threads", _results.runOptions.threads, "Number of threads used by parallel engine")
+            ->check(CLI::PositiveNumber);
+
+        auto replicas = _app->add_option("-n,--replicas", _results.replicas,
+                                         "Runs given number of independent replicas and prints aggregated statistics")
+                            ->check(CLI::PositiveNumber);
+
+        _app->add_option("-s,--seed", _results.seed, "Seed of random stream, replica streams are derived from it");
+
+        auto sweep = _app->add_option("-w,--sweep", _results.sweepParameters,
+                                      "Runs every combination of swept parameters: <worker|ramp|link>:<id>=<values>, "
+                                      "where values are list <v1>,<v2>... or range <from>:<to>:<step>");
+
+        auto checkpoint = _app->add_option("-c,--checkpoint", _results.runOptions.checkpointFile,
+                                           "Simulation state will be saved to this file every checkpoint interval")
+                              ->excludes(replicas)
+                              ->excludes(sweep);
+
+        _app->add_option("-k,--checkpointInterval", _results.runOptions.checkpointInterval,
+                         "Checkpoint will be saved every interval")
+            ->needs(checkpoint);
+
+        auto resume = _app->add_flag("--resume", _results.resume, "Resumes simulation from checkpoint file")
+            ->needs(checkpoint)
+            ->excludes(replicas)
+            ->excludes(sweep);
+
+        _app->add_option("--pendingRaports", _results.runOptions.pendingRaports,
+                         "Maximum number of state raports formatted in background, 0 formats them synchronously");
+
+        _app->add_option("--raportMode", _results.runOptions.raportMode,
+                         "State raport mode: full - prints every node, delta - prints only nodes changed since "
+                         "previous raport with periodic full keyframes, summary - prints queue length, oldest and "
+                         "newest product and age percentiles with limited list of products")
+            ->transform(CLI::CheckedTransformer(
+                std::map<std::string, RaportMode>{
+                    {"full", RaportMode::FULL}, {"delta", RaportMode::DELTA}, {"summary", RaportMode::SUMMARY}},
+                CLI::ignore_case));
+
+        _app->add_option("--keyframeInterval", _results.runOptions.keyframeInterval,
+                         "Every n-th delta raport is printed in full, 0 prints only first one in full");
+
+        _app->add_option("--summaryProductsLimit", _results.runOptions.summaryProductsLimit,
+                         "Maximum number of products listed per queue in summary raports");
+
+        _app->add_option("--trace", _results.runOptions.traceFile,
+                         "Binary trace of every product event will be written to this file")
+            ->excludes(replicas)
+            ->excludes(sweep)
+            ->excludes(resume);
+
+        auto metrics = _app->add_option("--metricsFile", _results.runOptions.metricsFile,
+                                        "Queue lengths and busy state of every worker and storehouse will be written "
+                                        "to this columnar file")
+                           ->excludes(replicas)
+                           ->excludes(sweep)
+                           ->excludes(resume);
+
+        _app->add_option("--metricsInterval", _results.runOptions.metricsInterval,
+                         "Metrics will be sampled every interval")
+            ->check(CLI::PositiveNumber)
+            ->needs(metrics);
+
+        _app->add_option("--metricsWindow", _results.runOptions.metricsWindow,
+                         "Every window of samples is stored as min, max and mean, 0 stores raw samples")
+            ->needs(metrics);
+
+        _app->add_flag("--latency", _results.runOptions.trackLatency,
+                       "Sojourn, waiting and service times of every worker and storehouse will be appended to raport")
+            ->excludes(replicas)
+            ->excludes(sweep)
+            ->excludes(resume);
+
         auto file = _app->add_option("-f,--file", _results.structureFile, "File that contains fabric structure");
         file->check(CLI::ExistingFile);
         file->required();
@@ -1,9 +1,13 @@
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <random>
 
 #include "CLI11.hpp"
 #include "Controler.hpp"
+#include "ParameterSweep.hpp"
+#include "ReplicationRunner.hpp"
+#include "StructureFile.hpp"
 #include "Utils.hpp"
 
 namespace sd
@@ -22,6 +26,8 @@ namespace sd
         double probability;
         std::pair<size_t, NodeType> source;
         std::pair<size_t, NodeType> destination;
+        // save
+        std::string outputFile;
 
         bool breakFromCliMode = false;
 
@@ -35,17 +41,10 @@ namespace sd
                 {
                     throw std::runtime_error(std::format("File {}, does not exists", filePath));
                 }
-                std::ifstream file(filePath);
-                file >> *factory;
+                StructureFile::load(*factory, filePath);
             }
             return std::move(factory);
         }
-
-        void saveFactoryToFile(const Factory &factory, const std::filesystem::path &filePath)
-        {
-            std::ofstream file(filePath);
-            file << factory;
-        }
     } // namespace
 
     Controler::Controler(const Configuration &config, std::ostream &out, std::ostream &err, std::istream &in)
@@ -118,8 +117,14 @@ namespace sd
             breakFromCliMode = true;
         });
 
-        _cli->add_subcommand("save", "Saves factory structure to file")->callback([this]() {
-            saveFactoryToFile(*_factory, *_config.structureFile);
+        auto save = _cli->add_subcommand("save", "Saves factory structure to file");
+        save->add_option("-o,--output", outputFile,
+                         std::format("Output file, defaults to structure file, files with {} extension are saved in "
+                                     "binary format",
+                                     StructureFile::BinaryExtension));
+        save->callback([this]() {
+            StructureFile::save(*_factory, outputFile.empty() ? *_config.structureFile : outputFile);
+            outputFile.clear();
         });
 
         _cli->add_subcommand("print", "Prints factory structure")->callback([this]() {
@@ -190,24 +195,100 @@ namespace sd
             }
         }
         getOut() << " ============================== STARTING SIMULATION ============================== " << std::endl;
-        runSimulation(_config.raportFile, _config.maxIterations, {_config.stateRaportTimings});
+        if (!_config.sweepParameters.empty())
+        {
+            runSweep(_config.raportFile, _config.maxIterations, _config.replicas.value_or(1), _config.runOptions);
+        }
+        else if (_config.replicas)
+        {
+            runReplications(_config.raportFile, _config.maxIterations, *_config.replicas, _config.runOptions);
+        }
+        else
+        {
+            if (_config.seed)
+            {
+                _factory->setContext(ReplicationRunner::createReplicaContext(*_config.seed, 0));
+            }
+            auto options = _config.runOptions;
+            std::optional<uint64_t> raportOffset;
+            if (_config.resume)
+            {
+                auto checkpoint = _factory->loadCheckpoint(std::filesystem::path{*options.checkpointFile});
+                options.startTime = checkpoint.time;
+                // latency is tracked on resume only when the checkpoint carries its statistics
+                options.trackLatency = _factory->getLatencyTracker() != nullptr;
+                raportOffset = checkpoint.raportOffset;
+            }
+            runSimulation(_config.raportFile, _config.maxIterations, {_config.stateRaportTimings}, options,
+                          raportOffset);
+        }
         getOut() << " ================================ SIMULATION ENDED =============================== " << std::endl;
     }
 
     void Controler::runSimulation(const std::optional<std::string> &raportfilePath, size_t maxIterations,
-                                  const Factory::RaportGuard &raportGuard)
+                                  const Factory::RaportGuard &raportGuard, const RunOptions &options,
+                                  const std::optional<uint64_t> &raportOffset)
+    {
+        if (raportfilePath)
+        {
+            std::ofstream file;
+            if (raportOffset)
+            {
+                std::filesystem::resize_file(*raportfilePath, *raportOffset);
+                file.open(*raportfilePath, std::ios::in | std::ios::out);
+                file.seekp(0, std::ios::end);
+            }
+            else
+            {
+                file.open(*raportfilePath);
+            }
+            _factory->run(maxIterations, file, raportGuard, options);
+        }
+        else
+        {
+            _factory->run(maxIterations, getOut(), raportGuard, options);
+        }
+    }
+
+    void Controler::runReplications(const std::optional<std::string> &raportfilePath, size_t maxIterations,
+                                    size_t replicas, const RunOptions &options)
+    {
+        ReplicationRunner runner{*_factory, replicas, getSeed()};
+        runner.run(maxIterations, options);
+        writeRaport(raportfilePath, runner.generateStatisticsRaport());
+    }
+
+    void Controler::runSweep(const std::optional<std::string> &raportfilePath, size_t maxIterations, size_t replicas,
+                             const RunOptions &options)
+    {
+        std::vector<ParameterSweep::Parameter> parameters;
+        for (auto &definition : _config.sweepParameters)
+        {
+            parameters.push_back(ParameterSweep::Parameter::parse(definition));
+        }
+        ParameterSweep sweep{*_factory, std::move(parameters), replicas, getSeed()};
+        sweep.run(maxIterations, options);
+        writeRaport(raportfilePath, sweep.generateResultsTable());
+    }
+
+    void Controler::writeRaport(const std::optional<std::string> &raportfilePath, const std::string &raport)
     {
         if (raportfilePath)
         {
             std::ofstream file(*raportfilePath);
-            _factory->run(maxIterations, file, raportGuard);
+            file << raport;
         }
         else
         {
-            _factory->run(maxIterations, getOut(), raportGuard);
+            getOut() << raport;
         }
     }
 
+    uint64_t Controler::getSeed() const
+    {
+        return _config.seed ? *_config.seed : uint64_t{std::random_device{}()};
+    }
+
     std::ostream &Controler::getOut()
     {
         return _out;
@@ -0,0 +1,60 @@
+#include "DeltaRaportTracker.hpp"
+
+namespace sd
+{
+    DeltaRaportTracker::DeltaRaportTracker(size_t keyframeInterval) : _keyframeInterval(keyframeInterval)
+    {
+    }
+
+    bool DeltaRaportTracker::beginRaport(size_t workersCount, size_t storeHousesCount)
+    {
+        auto keyframe = _raportsCount == 0 || (_keyframeInterval > 0 && _raportsCount % _keyframeInterval == 0);
+        if (_workers.size() != workersCount || _storeHouses.size() != storeHousesCount)
+        {
+            _workers.assign(workersCount, {});
+            _storeHouses.assign(storeHousesCount, NotReported);
+            keyframe = true;
+        }
+        ++_raportsCount;
+        return keyframe;
+    }
+
+    bool DeltaRaportTracker::updateWorker(size_t index, uint64_t version, const RaportSnapshot::WorkerState &state)
+    {
+        auto &mark = _workers[index];
+        if (mark.version == version && mark.currentProduct == state.currentProduct &&
+            mark.processingTime == state.processingTime)
+        {
+            return false;
+        }
+        mark = {version, state.currentProduct, state.processingTime};
+        return true;
+    }
+
+    bool DeltaRaportTracker::updateStoreHouse(size_t index, uint64_t version)
+    {
+        if (_storeHouses[index] == version)
+        {
+            return false;
+        }
+        _storeHouses[index] = version;
+        return true;
+    }
+
+    void DeltaRaportTracker::saveCheckpoint(BinaryWriter &writer) const
+    {
+        writer.write<uint64_t>(_keyframeInterval);
+        writer.write<uint64_t>(_raportsCount);
+        writer.writeVector(_workers);
+        writer.writeVector(_storeHouses);
+    }
+
+    std::unique_ptr<DeltaRaportTracker> DeltaRaportTracker::loadCheckpoint(BinaryReader &reader)
+    {
+        auto tracker = std::make_unique<DeltaRaportTracker>(reader.read<uint64_t>());
+        tracker->_raportsCount = reader.read<uint64_t>();
+        tracker->_workers = reader.readVector<WorkerMark>();
+        tracker->_storeHouses = reader.readVector<uint64_t>();
+        return tracker;
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "EventScheduler.hpp"
+
+namespace sd
+{
+    EventScheduler::EventScheduler(std::vector<LoadingRamp *> ramps, std::vector<Worker *> workers, size_t startTime,
+                                   EventTrace *trace, LatencyTracker *latency)
+        : _ramps(std::move(ramps)), _workers(std::move(workers)), _trace(trace), _latency(latency),
+          _rampSyncTimes(_ramps.size(), startTime), _workerSyncTimes(_workers.size(), startTime),
+          _workerProcessTimes(_workers.size(), NotScheduled), _waitingSources(_workers.size())
+    {
+        for (size_t index = 0; index < _ramps.size(); ++index)
+        {
+            if (_ramps[index]->isBlocked())
+            {
+                _calendar.push({startTime, RAMP_DELIVERY, index});
+            }
+            else
+            {
+                scheduleRamp(index);
+            }
+        }
+        for (size_t index = 0; index < _workers.size(); ++index)
+        {
+            auto &worker = *_workers[index];
+            _workerIndexes.emplace(&worker, index);
+            if (worker.isProductReady())
+            {
+                _calendar.push({startTime, WORKER_PASS, index});
+            }
+            if (!worker.isBlocked())
+            {
+                resumeWorker(index, startTime);
+            }
+        }
+    }
+
+    void EventScheduler::runUntil(size_t endTime)
+    {
+        while (!_calendar.empty() && _calendar.top().time < endTime)
+        {
+            auto event = _calendar.top();
+            _calendar.pop();
+            if (_trace)
+            {
+                _trace->setTime(event.time);
+            }
+            if (_latency)
+            {
+                _latency->setTime(event.time);
+            }
+            switch (event.type)
+            {
+            case RAMP_DELIVERY:
+                deliver(event.index, event.time);
+                break;
+            case WORKER_PASS:
+                passFromWorker(event.index, event.time);
+                break;
+            case WORKER_PROCESS:
+                processWorker(event.index, event.time);
+                break;
+            }
+        }
+        synchronize(endTime);
+    }
+
+    void EventScheduler::deliver(size_t index, size_t time)
+    {
+        auto &ramp = *_ramps[index];
+        if (!ramp.isBlocked())
+        {
+            ramp.skip(time - _rampSyncTimes[index]);
+            ramp.process(time);
+        }
+        _rampSyncTimes[index] = time + 1;
+        notifyArrival(ramp.passProduct(), time);
+        if (ramp.isBlocked())
+        {
+            waitForSpace(ramp, RAMP_DELIVERY, index);
+        }
+        else
+        {
+            scheduleRamp(index);
+        }
+    }
+
+    void EventScheduler::passFromWorker(size_t index, size_t time)
+    {
+        auto &worker = *_workers[index];
+        auto wasBlocked = worker.isBlocked();
+        notifyArrival(worker.passProduct(), time);
+        if (worker.isBlocked())
+        {
+            _workerProcessTimes[index] = NotScheduled;
+            waitForSpace(worker, WORKER_PASS, index);
+        }
+        else if (wasBlocked)
+        {
+            _workerSyncTimes[index] = time;
+            resumeWorker(index, time);
+        }
+    }
+
+    void EventScheduler::processWorker(size_t index, size_t time)
+    {
+        if (_workerProcessTimes[index] != time)
+        {
+            return;
+        }
+        auto &worker = *_workers[index];
+        auto queued = worker.getStoredProductsSize();
+        worker.skip(time - _workerSyncTimes[index]);
+        worker.process(time);
+        _workerSyncTimes[index] = time + 1;
+        if (worker.isProductReady())
+        {
+            _calendar.push({time + 1, WORKER_PASS, index});
+        }
+        scheduleWorker(index);
+        if (worker.getStoredProductsSize() < queued)
+        {
+            notifySpace(index, time + 1);
+        }
+    }
+
+    void EventScheduler::notifyArrival(const DestinationNode *destination, size_t time)
+    {
+        if (!destination)
+        {
+            return;
+        }
+        if (auto found = _workerIndexes.find(destination); found != _workerIndexes.end())
+        {
+            auto index = found->second;
+            if (_workerProcessTimes[index] == NotScheduled && !_workers[index]->isBlocked())
+            {
+                _workerProcessTimes[index] = time;
+                _calendar.push({time, WORKER_PROCESS, index});
+            }
+        }
+    }
+
+    void EventScheduler::waitForSpace(const SourceNode &source, EventType type, size_t index)
+    {
+        if (auto found = _workerIndexes.find(source.getBlockedDestination()); found != _workerIndexes.end())
+        {
+            _waitingSources[found->second].push_back({0, type, index});
+        }
+    }
+
+    void EventScheduler::notifySpace(size_t index, size_t time)
+    {
+        for (auto &event : _waitingSources[index])
+        {
+            _calendar.push({time, event.type, event.index});
+        }
+        _waitingSources[index].clear();
+    }
+
+    void EventScheduler::resumeWorker(size_t index, size_t time)
+    {
+        if (_workers[index]->isProcessingProduct())
+        {
+            scheduleWorker(index);
+        }
+        else if (_workers[index]->areProductsAvailable())
+        {
+            _workerProcessTimes[index] = time;
+            _calendar.push({time, WORKER_PROCESS, index});
+        }
+    }
+
+    void EventScheduler::scheduleRamp(size_t index)
+    {
+        auto time = _rampSyncTimes[index] + _ramps[index]->getRemainingProcesingTime() - 1;
+        _calendar.push({time, RAMP_DELIVERY, index});
+    }
+
+    void EventScheduler::scheduleWorker(size_t index)
+    {
+        auto &worker = *_workers[index];
+        if (worker.isProcessingProduct())
+        {
+            auto time = _workerSyncTimes[index] + worker.getRemainingProcesingTime() - 1;
+            _workerProcessTimes[index] = time;
+            _calendar.push({time, WORKER_PROCESS, index});
+        }
+        else
+        {
+            _workerProcessTimes[index] = NotScheduled;
+        }
+    }
+
+    void EventScheduler::synchronize(size_t endTime)
+    {
+        for (size_t index = 0; index < _ramps.size(); ++index)
+        {
+            _ramps[index]->skip(endTime - _rampSyncTimes[index]);
+            _rampSyncTimes[index] = endTime;
+        }
+        for (size_t index = 0; index < _workers.size(); ++index)
+        {
+            _workers[index]->skip(endTime - _workerSyncTimes[index]);
+            _workerSyncTimes[index] = endTime;
+        }
+    }
+} // namespace sd
\ No newline at end of file
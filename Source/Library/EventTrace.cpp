@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+#include "EventTrace.hpp"
+
+namespace sd
+{
+    EventTrace::EventTrace(TraceWriter &writer, size_t startTime)
+        : _writer(&writer), _buffer(BlockSize), _time(startTime)
+    {
+        auto out = std::copy(Magic.begin(), Magic.end(), prepare(Magic.size() + 1 + MaxVarintSize));
+        *out++ = Version;
+        commit(writeVarint(out, startTime));
+    }
+
+    void EventTrace::setTime(size_t time)
+    {
+        if (time == _time)
+        {
+            return;
+        }
+        if (time < _time)
+        {
+            throw std::runtime_error(std::format("Trace time cannot go back from {} to {}", _time, time));
+        }
+        auto out = prepare(1 + MaxVarintSize);
+        *out++ = TICK;
+        commit(writeVarint(out, time - _time));
+        _time = time;
+    }
+
+    size_t EventTrace::getTime() const
+    {
+        return _time;
+    }
+
+    void EventTrace::append(EventTrace &other)
+    {
+        auto &buffer = other._buffer;
+        commit(std::copy_n(buffer.begin(), other._size, prepare(other._size)));
+        other._size = 0;
+    }
+
+    void EventTrace::flush()
+    {
+        if (_writer && _size > 0)
+        {
+            _writer->append(_buffer.data(), _size);
+            _size = 0;
+        }
+    }
+
+    const uint8_t *EventTrace::readVarint(const uint8_t *in, const uint8_t *end, uint64_t &value)
+    {
+        value = 0;
+        for (size_t shift = 0; in != end && shift < 64; shift += 7)
+        {
+            auto byte = *in++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+            {
+                return in;
+            }
+        }
+        throw std::runtime_error("Trace contains truncated varint");
+    }
+
+    void EventTrace::reserve(size_t size)
+    {
+        flush();
+        if (_size + size > _buffer.size())
+        {
+            _buffer.resize(std::max(_buffer.size() * 2, _size + size));
+        }
+    }
+} // namespace sd
\ No newline at end of file
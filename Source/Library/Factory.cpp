@@ -1,27 +1,57 @@
+#include <algorithm>
 #include <format>
+#include <fstream>
+#include <limits>
 
+#include "AsyncRaportWriter.hpp"
+#include "DeltaRaportTracker.hpp"
+#include "EventScheduler.hpp"
 #include "Factory.hpp"
+#include "FactoryEdit.hpp"
+#include "FlatFactory.hpp"
+#include "LatencyTracker.hpp"
+#include "MetricsRecorder.hpp"
+#include "ParallelScheduler.hpp"
+#include "Random.hpp"
+#include "TextRaportSink.hpp"
 
 namespace sd
 {
     namespace
     {
-        struct dEnd
+        constexpr uint32_t checkpointMagic = 0x50434453;
+        constexpr uint32_t checkpointVersion = 1;
+        constexpr uint64_t noValue = static_cast<uint64_t>(-1);
+
+        std::filesystem::path getJournalPath(std::filesystem::path checkpointPath)
         {
-        };
+            checkpointPath += ".stores";
+            return checkpointPath;
+        }
 
-        std::ostream &operator<<(std::ostream &out, const dEnd &t)
+        void readCheckpointCount(BinaryReader &reader, size_t count, const std::string &name)
         {
-            out << std::endl << std::endl;
-            return out;
+            if (reader.read<uint64_t>() != count)
+            {
+                throw std::runtime_error(std::format("Checkpoint {} count does not match factory structure", name));
+            }
         }
 
-        void processItem(Processable &item, size_t currentTime)
+        void readCheckpointId(BinaryReader &reader, size_t id, const std::string &name)
+        {
+            if (reader.read<uint64_t>() != id)
+            {
+                throw std::runtime_error(
+                    std::format("Checkpoint {} of id {} does not match factory structure", name, id));
+            }
+        }
+
+        template <class Item> void processItem(Item &item, size_t currentTime)
         {
             item.process(currentTime);
         }
 
-        void tryPassProducts(SourceNode &node)
+        template <class Item> void tryPassProducts(Item &node)
         {
             if (node.isProductReady())
             {
@@ -30,6 +60,12 @@ namespace sd
         }
     } // namespace
 
+    struct Factory::CheckpointJournal
+    {
+        std::fstream stream;
+        std::vector<size_t> storedProducts;
+    };
+
     Factory::RaportGuard::RaportGuard(const std::variant<size_t, std::vector<size_t>> &var)
     {
         if (const size_t *intervalPtr = std::get_if<size_t>(&var))
@@ -84,6 +120,47 @@ namespace sd
         return false;
     }
 
+    std::optional<size_t> Factory::RaportGuard::getNextRaportTime(size_t currentIteration) const
+    {
+        if (const Interval *interval = std::get_if<Interval>(&_raportTimes))
+        {
+            if (*interval == 0)
+            {
+                return std::nullopt;
+            }
+            auto remainder = currentIteration % *interval;
+            return remainder == 0 ? currentIteration : currentIteration + (*interval - remainder);
+        }
+        else if (const RaportTimes *raportTimesPtr = std::get_if<RaportTimes>(&_raportTimes))
+        {
+            auto &raportTimesVector = raportTimesPtr->raportTimes;
+            auto found = std::lower_bound(raportTimesVector.begin(), raportTimesVector.end(), currentIteration);
+            if (found != raportTimesVector.end())
+            {
+                return *found;
+            }
+            return std::nullopt;
+        }
+        throw std::runtime_error("Raport Info Error");
+    }
+
+    Factory::Factory() = default;
+
+    Factory::Factory(const FactoryStructure &structure)
+    {
+        addStructure(structure);
+    }
+
+    void Factory::RaportGuard::seek(size_t currentIteration) const
+    {
+        if (const RaportTimes *raportTimesPtr = std::get_if<RaportTimes>(&_raportTimes))
+        {
+            auto &raportTimesVector = raportTimesPtr->raportTimes;
+            auto found = std::lower_bound(raportTimesVector.begin(), raportTimesVector.end(), currentIteration);
+            raportTimesPtr->nextRaportIndex = static_cast<size_t>(found - raportTimesVector.begin());
+        }
+    }
+
     void Factory::addWorker(const WorkerData &data)
     {
         auto res = _workers.emplace(data.id, std::make_unique<Worker>(data));
@@ -91,6 +168,8 @@ namespace sd
         {
             throw std::runtime_error(std::format("Worker of id {} was already created.", data.id));
         }
+        res.first->second->setContext(_context.get());
+        res.first->second->setProductPool(&_productPool);
     }
 
     void Factory::addLoadingRamp(const LoadingRampData &data)
@@ -100,6 +179,8 @@ namespace sd
         {
             throw std::runtime_error(std::format("Loading ramp of id {} was already created.", data.id));
         }
+        res.first->second->setContext(_context.get());
+        res.first->second->setProductPool(&_productPool);
     }
 
     void Factory::addStorehouse(const StoreHouseData &data)
@@ -109,9 +190,69 @@ namespace sd
         {
             throw std::runtime_error(std::format("Storehouse of id {} was already created.", data.id));
         }
+        res.first->second->setContext(_context.get());
+        res.first->second->setProductPool(&_productPool);
     }
 
     void Factory::addLink(const LinkData &data)
+    {
+        auto &link = createLink(data);
+        link.getSource().bindSourceLink(link);
+    }
+
+    void Factory::addStructure(const FactoryStructure &structure)
+    {
+        _loadingRamps.reserve(_loadingRamps.size() + structure.loadingRamps.size());
+        _workers.reserve(_workers.size() + structure.workers.size());
+        _storeHouses.reserve(_storeHouses.size() + structure.storeHouses.size());
+        _links.reserve(_links.size() + structure.links.size());
+        for (auto &ramp : structure.loadingRamps)
+        {
+            addLoadingRamp(ramp);
+        }
+        for (auto &worker : structure.workers)
+        {
+            addWorker(worker);
+        }
+        for (auto &store : structure.storeHouses)
+        {
+            addStorehouse(store);
+        }
+
+        try
+        {
+            for (auto &data : structure.links)
+            {
+                auto &link = createLink(data);
+                link.getSource().appendSourceLink(link);
+            }
+        }
+        catch (...)
+        {
+            normalizeSources();
+            throw;
+        }
+        normalizeSources();
+    }
+
+    FactoryEdit Factory::edit()
+    {
+        return FactoryEdit{*this};
+    }
+
+    void Factory::normalizeSources()
+    {
+        for (auto &[_, ramp] : _loadingRamps)
+        {
+            ramp->normalize();
+        }
+        for (auto &[_, worker] : _workers)
+        {
+            worker->normalize();
+        }
+    }
+
+    Link &Factory::createLink(const LinkData &data)
     {
         SourceNode::RawPtr sourceNode;
         DestinationNode::RawPtr destinationNode;
@@ -174,14 +315,17 @@ namespace sd
             }
         }
 
-        auto link = std::make_shared<Link>(data, *sourceNode, *destinationNode);
-        auto res = _links.emplace(data.id, link);
-        if (!res.second)
+        auto &link = _links.emplace(data, *sourceNode, *destinationNode);
+        destinationNode->bindDestinationLink(link);
+        return link;
+    }
+
+    void Factory::eraseLinks(const std::vector<Link *> &links)
+    {
+        for (auto link : links)
         {
-            throw std::runtime_error(std::format("Link of id {} was already created.", data.id));
+            _links.erase(link->getId());
         }
-        sourceNode->bindSourceLink(link);
-        destinationNode->bindDestinationLink(link);
     }
 
     void Factory::removeWorker(size_t id)
@@ -189,10 +333,12 @@ namespace sd
         if (auto workerPair = _workers.find(id); workerPair != _workers.end())
         {
             auto &worker = workerPair->second;
+            auto links = worker->getDestinationLinks();
             worker->unbindAllDestinations();
+            links.insert(links.end(), worker->getSourceLinks().begin(), worker->getSourceLinks().end());
             worker->unbindAllSources();
             _workers.erase(workerPair);
-            removeExpiredLinks();
+            eraseLinks(links);
         }
     }
 
@@ -201,9 +347,10 @@ namespace sd
         if (auto rampPair = _loadingRamps.find(id); rampPair != _loadingRamps.end())
         {
             auto &ramp = rampPair->second;
+            auto links = ramp->getSourceLinks();
             ramp->unbindAllSources();
             _loadingRamps.erase(rampPair);
-            removeExpiredLinks();
+            eraseLinks(links);
         }
     }
 
@@ -212,23 +359,20 @@ namespace sd
         if (auto storePair = _storeHouses.find(id); storePair != _storeHouses.end())
         {
             auto &store = storePair->second;
+            auto links = store->getDestinationLinks();
             store->unbindAllDestinations();
             _storeHouses.erase(storePair);
-            removeExpiredLinks();
+            eraseLinks(links);
         }
     }
 
     void Factory::removeLink(size_t id)
     {
-        if (auto linkPair = _links.find(id); linkPair != _links.end())
+        if (auto link = _links.find(id))
         {
-            auto link = linkPair->second.lock();
-            if (link)
-            {
-                link->unBindDestination();
-                link->unBindSource();
-            }
-            _links.erase(linkPair);
+            link->unBindDestination();
+            link->unBindSource();
+            _links.erase(id);
         }
     }
 
@@ -269,20 +413,43 @@ namespace sd
     {
         std::vector<LinkData> res;
         res.reserve(_links.size());
-        for (auto &[_, link] : _links)
+        for (auto link : _links.getLinksInOrder())
         {
-            if (!link.expired())
-            {
-                res.push_back(link.lock()->getLinkData());
-            }
+            res.push_back(link->getLinkData());
         }
         return res;
     }
 
-    size_t Factory::removeExpiredLinks()
+    FactoryStructure Factory::getStructure() const
     {
-        return std::erase_if(
-            _links, [](const std::pair<const size_t, sd::Link::WeakPtr> &item) { return item.second.expired(); });
+        return {getLoadingRampsData(), getWorkersData(), getStorehousesData(), getLinksData()};
+    }
+
+    Factory::Ptr Factory::cloneStructure() const
+    {
+        return std::make_unique<Factory>(getStructure());
+    }
+
+    void Factory::setContext(SimulationContext::Ptr context)
+    {
+        _context = std::move(context);
+        for (auto &[_, ramp] : _loadingRamps)
+        {
+            ramp->setContext(_context.get());
+        }
+        for (auto &[_, worker] : _workers)
+        {
+            worker->setContext(_context.get());
+        }
+        for (auto &[_, store] : _storeHouses)
+        {
+            store->setContext(_context.get());
+        }
+    }
+
+    const SimulationContext::Ptr &Factory::getContext() const
+    {
+        return _context;
     }
 
     void Factory::validate() const
@@ -318,41 +485,191 @@ namespace sd
         }
     }
 
-    std::string Factory::generateStateRaport()
+    std::string Factory::generateStateRaport() const
+    {
+        std::string out;
+        TextRaportSink sink{out};
+        writeStateRaport(sink);
+        return out;
+    }
+
+    void Factory::writeStateRaport(IRaportSink &sink) const
     {
-        std::stringstream out;
-        out << "== WORKERS ==" << dEnd{};
+        sink.beginSection("WORKERS");
         for (auto &[_, worker] : _workers)
         {
-            out << worker->getStateRaport(0) << dEnd{};
+            worker->writeStateRaport(sink, 0);
+            sink.endNode();
         }
-        out << "== STOREHOUSES ==" << dEnd{};
+        sink.beginSection("STOREHOUSES");
         for (auto &[_, store] : _storeHouses)
         {
-            out << store->getStateRaport(0) << dEnd{};
+            store->writeStateRaport(sink, 0);
+            sink.endNode();
+        }
+    }
+
+    void Factory::captureStateSnapshot(RaportSnapshot &snapshot, size_t time, DeltaRaportTracker *tracker,
+                                       std::optional<size_t> summaryProductsLimit) const
+    {
+        snapshot.clear();
+        snapshot.time = time;
+        snapshot.summary = summaryProductsLimit.has_value();
+        const auto productsLimit = summaryProductsLimit.value_or(std::numeric_limits<size_t>::max());
+        auto keyframe = !tracker || tracker->beginRaport(_workers.size(), _storeHouses.size());
+        snapshot.delta = !keyframe;
+
+        size_t index = 0;
+        for (auto &[id, worker] : _workers)
+        {
+            auto product = worker->getCurrentProduct();
+            RaportSnapshot::WorkerState state{id, product ? product->getId() : RaportSnapshot::NoProduct,
+                                              worker->getCurrentProcesingTime(), 0};
+            auto changed = !tracker || tracker->updateWorker(index++, worker->getVersion(), state);
+            if (keyframe || changed)
+            {
+                worker->appendStoredProductIds(snapshot.products, productsLimit);
+                state.productsEnd = snapshot.products.size();
+                snapshot.workers.push_back(state);
+                if (snapshot.summary)
+                {
+                    snapshot.summaries.push_back(QueueSummary::create(*worker, time));
+                }
+            }
+        }
+        index = 0;
+        for (auto &[id, store] : _storeHouses)
+        {
+            auto changed = !tracker || tracker->updateStoreHouse(index++, store->getVersion());
+            if (keyframe || changed)
+            {
+                store->appendStoredProductIds(snapshot.products, productsLimit);
+                snapshot.storeHouses.push_back({id, snapshot.products.size()});
+                if (snapshot.summary)
+                {
+                    snapshot.summaries.push_back(QueueSummary::create(*store, time));
+                }
+            }
         }
-        return out.str();
     }
 
-    std::string Factory::generateStructureRaport()
+    std::string Factory::generateStructureRaport() const
     {
-        std::stringstream out;
-        out << "== LOADING RAMPS ==" << dEnd{};
+        std::string out;
+        TextRaportSink sink{out};
+        writeStructureRaport(sink);
+        return out;
+    }
+
+    void Factory::writeStructureRaport(IRaportSink &sink) const
+    {
+        sink.beginSection("LOADING RAMPS");
         for (auto &[_, ramp] : _loadingRamps)
         {
-            out << ramp->getStructureRaport(0) << dEnd{};
+            ramp->writeStructureRaport(sink, 0);
+            sink.endNode();
         }
-        out << "== WORKERS ==" << dEnd{};
+        sink.beginSection("WORKERS");
         for (auto &[_, worker] : _workers)
         {
-            out << worker->getStructureRaport(0) << dEnd{};
+            worker->writeStructureRaport(sink, 0);
+            sink.endNode();
         }
-        out << "== STOREHOUSES ==" << dEnd{};
+        sink.beginSection("STOREHOUSES");
         for (auto &[_, store] : _storeHouses)
         {
-            out << store->getStructureRaport(0) << dEnd{};
+            store->writeStructureRaport(sink, 0);
+            sink.endNode();
+        }
+    }
+
+    void Factory::saveCheckpoint(std::ostream &out, const CheckpointInfo &info) const
+    {
+        BinaryWriter writer{out};
+        writeCheckpointState(writer, info, std::nullopt);
+        for (auto &[id, store] : _storeHouses)
+        {
+            writer.write<uint64_t>(id);
+            store->saveCheckpoint(writer, _latency != nullptr);
+        }
+        if (!out)
+        {
+            throw std::runtime_error("Could not write checkpoint");
+        }
+    }
+
+    Factory::CheckpointInfo Factory::loadCheckpoint(std::istream &in)
+    {
+        BinaryReader reader{in};
+        CheckpointInfo info;
+        if (readCheckpointState(reader, info))
+        {
+            throw std::runtime_error("Checkpoint with storehouse journal must be loaded from file");
+        }
+        _loadedJournalSize.reset();
+        for (auto &[id, store] : _storeHouses)
+        {
+            readCheckpointId(reader, id, "Storehouse");
+            store->loadCheckpoint(reader);
+        }
+        return info;
+    }
+
+    Factory::CheckpointInfo Factory::loadCheckpoint(const std::filesystem::path &checkpointPath)
+    {
+        if (!std::filesystem::exists(checkpointPath))
+        {
+            throw std::runtime_error(std::format("Checkpoint file {}, does not exists", checkpointPath.string()));
+        }
+        std::ifstream file(checkpointPath, std::ios::binary);
+        BinaryReader reader{file};
+        CheckpointInfo info;
+        auto journalSize = readCheckpointState(reader, info);
+        _loadedJournalSize = journalSize;
+        if (!journalSize)
+        {
+            for (auto &[id, store] : _storeHouses)
+            {
+                readCheckpointId(reader, id, "Storehouse");
+                store->loadCheckpoint(reader);
+            }
+            return info;
+        }
+
+        std::vector<uint64_t> storedProducts;
+        for (auto &[id, store] : _storeHouses)
+        {
+            readCheckpointId(reader, id, "Storehouse");
+            storedProducts.push_back(reader.read<uint64_t>());
+        }
+
+        auto journalPath = getJournalPath(checkpointPath);
+        if (!std::filesystem::exists(journalPath) || std::filesystem::file_size(journalPath) < *journalSize)
+        {
+            throw std::runtime_error(std::format("Checkpoint journal {} is incomplete", journalPath.string()));
+        }
+        std::ifstream journal(journalPath, std::ios::binary);
+        BinaryReader journalReader{journal};
+        for (bool append = false; static_cast<uint64_t>(journal.tellg()) < *journalSize; append = true)
+        {
+            for (auto &[_, store] : _storeHouses)
+            {
+                store->loadCheckpoint(journalReader, append);
+            }
+        }
+        size_t index = 0;
+        for (auto &[id, store] : _storeHouses)
+        {
+            if (store->getStoredProductsSize() != storedProducts[index++])
+            {
+                throw std::runtime_error(std::format("Checkpoint journal of Storehouse of id {} is corrupted", id));
+            }
         }
-        return out.str();
+        return info;
+    }
+
+    Factory::~Factory()
+    {
     }
 
     bool Factory::initialized() const
@@ -360,13 +677,181 @@ namespace sd
         return !_loadingRamps.empty() || !_workers.empty() || !_storeHouses.empty() || !_links.empty();
     }
 
-    void Factory::run(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard)
+    void Factory::run(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                      const RunOptions &options)
     {
-        raportOutStream << "========= Factory Structure ========" << std::endl;
-        raportOutStream << generateStructureRaport() << std::endl;
-        raportOutStream << "========= Simulation Start =========" << std::endl;
-        for (size_t time = 0; time < maxIterations; ++time)
+        if (options.raportSink && options.engine == SimulationEngine::FLAT)
         {
+            throw std::runtime_error("Flat engine does not support raport sinks");
+        }
+        if (options.startTime == 0 && options.structureRaport && options.raportSink)
+        {
+            writeStructureRaport(*options.raportSink);
+        }
+        else if (options.startTime == 0 && options.structureRaport)
+        {
+            raportOutStream << "========= Factory Structure ========" << std::endl;
+            raportOutStream << generateStructureRaport() << std::endl;
+            raportOutStream << "========= Simulation Start =========" << std::endl;
+        }
+        raportGuard.seek(options.startTime);
+        if (options.engine != SimulationEngine::FLAT)
+        {
+            openCheckpointJournal(options);
+        }
+        std::optional<TraceWriter> traceWriter;
+        std::optional<EventTrace> trace;
+        if (options.traceFile)
+        {
+            if (options.engine == SimulationEngine::FLAT)
+            {
+                throw std::runtime_error("Flat engine does not support event trace");
+            }
+            traceWriter.emplace(*options.traceFile);
+            trace.emplace(*traceWriter, options.startTime);
+        }
+        if (options.raportMode == RaportMode::DELTA)
+        {
+            if (options.engine == SimulationEngine::FLAT)
+            {
+                throw std::runtime_error("Flat engine does not support delta raports");
+            }
+            // tracker loaded with checkpoint continues its keyframe schedule
+            if (!_deltaTracker || options.startTime == 0)
+            {
+                _deltaTracker = std::make_unique<DeltaRaportTracker>(options.keyframeInterval);
+            }
+        }
+        else
+        {
+            _deltaTracker.reset();
+        }
+        if (options.raportMode == RaportMode::SUMMARY)
+        {
+            if (options.engine == SimulationEngine::FLAT)
+            {
+                throw std::runtime_error("Flat engine does not support summary raports");
+            }
+            _summaryProductsLimit = options.summaryProductsLimit;
+        }
+        if (options.metricsFile)
+        {
+            if (options.engine == SimulationEngine::FLAT)
+            {
+                throw std::runtime_error("Flat engine does not support metrics");
+            }
+            _metrics = std::make_unique<MetricsRecorder>(*options.metricsFile, getWorkersInOrder(),
+                                                         getStoreHousesInOrder(), options.startTime,
+                                                         options.metricsInterval, options.metricsWindow);
+        }
+        if (options.trackLatency)
+        {
+            if (options.engine == SimulationEngine::FLAT)
+            {
+                throw std::runtime_error("Flat engine does not support latency tracking");
+            }
+            // statistics loaded with checkpoint keep accumulating
+            if (!_latency || options.startTime == 0)
+            {
+                _latency = std::make_unique<LatencyTracker>(getWorkersInOrder(), getStoreHousesInOrder(),
+                                                            options.startTime);
+            }
+            _latency->setTime(options.startTime);
+            setLatencyTracker(_latency.get());
+        }
+        else
+        {
+            _latency.reset();
+        }
+        setTrace(trace ? &*trace : nullptr);
+        _raportSink = options.raportSink;
+        auto raportTime = raportGuard.getNextRaportTime(options.startTime);
+        if (options.engine != SimulationEngine::FLAT && options.pendingRaports > 0 && raportTime &&
+            *raportTime < maxIterations)
+        {
+            _raportWriter = _raportSink ? std::make_unique<AsyncRaportWriter>(*_raportSink, options.pendingRaports)
+                                        : std::make_unique<AsyncRaportWriter>(raportOutStream, options.pendingRaports);
+        }
+        try
+        {
+            switch (options.engine)
+            {
+            case SimulationEngine::TICK:
+                runTicks(maxIterations, raportOutStream, raportGuard, options);
+                break;
+            case SimulationEngine::EVENT:
+                runEvents(maxIterations, raportOutStream, raportGuard, options);
+                break;
+            case SimulationEngine::PARALLEL:
+                runParallel(maxIterations, raportOutStream, raportGuard, options);
+                break;
+            case SimulationEngine::FLAT:
+                runFlat(maxIterations, raportOutStream, raportGuard, options);
+                break;
+            default:
+                throw std::runtime_error("Unknown simulation engine");
+            }
+            if (_raportWriter)
+            {
+                _raportWriter->flush();
+            }
+        }
+        catch (...)
+        {
+            setTrace(nullptr);
+            if (_latency)
+            {
+                setLatencyTracker(nullptr);
+            }
+            _raportWriter.reset();
+            _raportSink = nullptr;
+            _deltaTracker.reset();
+            _summaryProductsLimit.reset();
+            _metrics.reset();
+            throw;
+        }
+        setTrace(nullptr);
+        _raportWriter.reset();
+        _raportSink = nullptr;
+        _deltaTracker.reset();
+        _summaryProductsLimit.reset();
+        if (_latency)
+        {
+            setLatencyTracker(nullptr);
+            if (options.raportSink)
+            {
+                _latency->writeRaport(*options.raportSink);
+            }
+            else
+            {
+                raportOutStream << _latency->generateRaport();
+            }
+        }
+        if (_metrics)
+        {
+            _metrics->close();
+            _metrics.reset();
+        }
+        if (traceWriter)
+        {
+            trace->flush();
+            traceWriter->close();
+        }
+    }
+
+    void Factory::runTicks(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                           const RunOptions &options)
+    {
+        for (size_t time = options.startTime; time < maxIterations; ++time)
+        {
+            if (_trace)
+            {
+                _trace->setTime(time);
+            }
+            if (_latency)
+            {
+                _latency->setTime(time);
+            }
             for (auto &[_, ramp] : _loadingRamps)
             {
                 processItem(*ramp, time);
@@ -384,11 +869,412 @@ namespace sd
                 processItem(*worker, time);
             }
 
+            recordMetrics(time);
+            if (raportGuard.isRaportTime(time))
+            {
+                writeStateRaport(raportOutStream, time);
+            }
+            if (isCheckpointTime(options, time + 1))
+            {
+                writeCheckpoint(options, time + 1, raportOutStream);
+            }
+        }
+    }
+
+    void Factory::runEvents(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                            const RunOptions &options)
+    {
+        EventScheduler scheduler{getLoadingRampsInOrder(), getWorkersInOrder(), options.startTime, _trace,
+                                 _latency.get()};
+        for (auto time = options.startTime; time < maxIterations;)
+        {
+            auto raportTime = raportGuard.getNextRaportTime(time);
+            auto checkpointTime = getNextCheckpointTime(options, time + 1);
+            auto metricsTime = _metrics ? std::optional{_metrics->getNextSampleTime(time)} : std::nullopt;
+
+            auto endTime = maxIterations;
+            if (raportTime && *raportTime < maxIterations)
+            {
+                endTime = *raportTime + 1;
+            }
+            if (checkpointTime && *checkpointTime < endTime)
+            {
+                endTime = *checkpointTime;
+            }
+            if (metricsTime && *metricsTime + 1 < endTime)
+            {
+                endTime = *metricsTime + 1;
+            }
+
+            scheduler.runUntil(endTime);
+            if (metricsTime && *metricsTime + 1 == endTime)
+            {
+                _metrics->sample();
+            }
+            if (raportTime && *raportTime + 1 == endTime)
+            {
+                writeStateRaport(raportOutStream, *raportTime);
+            }
+            if (checkpointTime && *checkpointTime == endTime)
+            {
+                writeCheckpoint(options, endTime, raportOutStream);
+            }
+            time = endTime;
+        }
+    }
+
+    void Factory::runParallel(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                              const RunOptions &options)
+    {
+        ParallelScheduler scheduler{getLoadingRampsInOrder(), getWorkersInOrder(), options.threads, _trace};
+        for (size_t time = options.startTime; time < maxIterations; ++time)
+        {
+            if (_latency)
+            {
+                _latency->setTime(time);
+            }
+            scheduler.tick(time);
+
+            recordMetrics(time);
             if (raportGuard.isRaportTime(time))
             {
-                raportOutStream << std::format("========= Iteration: {} =========", time) << std::endl;
-                raportOutStream << generateStateRaport();
+                writeStateRaport(raportOutStream, time);
             }
+            if (isCheckpointTime(options, time + 1))
+            {
+                writeCheckpoint(options, time + 1, raportOutStream);
+            }
+        }
+    }
+
+    void Factory::runFlat(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                          const RunOptions &options)
+    {
+        if (options.startTime > 0 || options.checkpointInterval > 0)
+        {
+            throw std::runtime_error("Flat engine does not support checkpoints");
+        }
+        FlatFactory flatFactory{*this};
+        flatFactory.run(maxIterations, raportOutStream, raportGuard, getRandomDevice());
+        flatFactory.writeState(*this);
+    }
+
+    void Factory::recordMetrics(size_t time)
+    {
+        if (_metrics && _metrics->isSampleTime(time))
+        {
+            _metrics->sample();
+        }
+    }
+
+    void Factory::setTrace(EventTrace *trace)
+    {
+        _trace = trace;
+        for (auto &[_, ramp] : _loadingRamps)
+        {
+            ramp->setTrace(trace);
+        }
+        for (auto &[_, worker] : _workers)
+        {
+            worker->setTrace(trace);
+        }
+        for (auto &[_, store] : _storeHouses)
+        {
+            store->setTrace(trace);
+        }
+    }
+
+    void Factory::setLatencyTracker(LatencyTracker *tracker)
+    {
+        for (auto &[_, ramp] : _loadingRamps)
+        {
+            ramp->setLatency(tracker);
+        }
+        for (auto &[id, worker] : _workers)
+        {
+            worker->setLatency(tracker, tracker ? &tracker->getWorkerLatency(id) : nullptr);
+        }
+        for (auto &[id, store] : _storeHouses)
+        {
+            store->setLatency(tracker, tracker ? &tracker->getStoreHouseLatency(id) : nullptr);
+        }
+    }
+
+    const LatencyTracker *Factory::getLatencyTracker() const
+    {
+        return _latency.get();
+    }
+
+    std::vector<LoadingRamp *> Factory::getLoadingRampsInOrder() const
+    {
+        std::vector<LoadingRamp *> ramps;
+        ramps.reserve(_loadingRamps.size());
+        for (auto &[_, ramp] : _loadingRamps)
+        {
+            ramps.push_back(ramp.get());
+        }
+        return ramps;
+    }
+
+    std::vector<Worker *> Factory::getWorkersInOrder() const
+    {
+        std::vector<Worker *> workers;
+        workers.reserve(_workers.size());
+        for (auto &[_, worker] : _workers)
+        {
+            workers.push_back(worker.get());
+        }
+        return workers;
+    }
+
+    std::vector<StoreHouse *> Factory::getStoreHousesInOrder() const
+    {
+        std::vector<StoreHouse *> storeHouses;
+        storeHouses.reserve(_storeHouses.size());
+        for (auto &[_, storeHouse] : _storeHouses)
+        {
+            storeHouses.push_back(storeHouse.get());
+        }
+        return storeHouses;
+    }
+
+    IRandomDevice &Factory::getRandomDevice() const
+    {
+        if (_context)
+        {
+            return _context->getRandomDevice();
+        }
+        return Random::get();
+    }
+
+    void Factory::writeStateRaport(std::ostream &raportOutStream, size_t time)
+    {
+        if (_raportWriter)
+        {
+            auto snapshot = _raportWriter->acquire();
+            captureStateSnapshot(snapshot, time, _deltaTracker.get(), _summaryProductsLimit);
+            _raportWriter->submit(std::move(snapshot));
+        }
+        else
+        {
+            std::string raport;
+            TextRaportSink textSink{raport};
+            IRaportSink &sink = _raportSink ? *_raportSink : textSink;
+            if (_deltaTracker || _summaryProductsLimit)
+            {
+                RaportSnapshot snapshot;
+                captureStateSnapshot(snapshot, time, _deltaTracker.get(), _summaryProductsLimit);
+                snapshot.replay(sink);
+                raportOutStream << raport << std::flush;
+            }
+            else
+            {
+                sink.beginRaport(time, false);
+                writeStateRaport(sink);
+                raportOutStream << raport;
+            }
+        }
+    }
+
+    bool Factory::isCheckpointTime(const RunOptions &options, size_t time) const
+    {
+        return options.checkpointFile && options.checkpointInterval > 0 && time % options.checkpointInterval == 0;
+    }
+
+    std::optional<size_t> Factory::getNextCheckpointTime(const RunOptions &options, size_t time) const
+    {
+        if (!options.checkpointFile || options.checkpointInterval == 0)
+        {
+            return std::nullopt;
+        }
+        auto remainder = time % options.checkpointInterval;
+        return remainder == 0 ? time : time + (options.checkpointInterval - remainder);
+    }
+
+    void Factory::openCheckpointJournal(const RunOptions &options)
+    {
+        _checkpointJournal.reset();
+        if (!options.checkpointFile || options.checkpointInterval == 0)
+        {
+            return;
+        }
+        auto journalPath = getJournalPath(*options.checkpointFile);
+        auto journal = std::make_unique<CheckpointJournal>();
+        if (options.startTime == 0 || !std::filesystem::exists(journalPath))
+        {
+            journal->stream.open(journalPath, std::ios::binary | std::ios::out | std::ios::trunc);
+            journal->storedProducts.assign(_storeHouses.size(), 0);
+        }
+        else
+        {
+            if (_loadedJournalSize)
+            {
+                std::filesystem::resize_file(journalPath, *_loadedJournalSize);
+            }
+            journal->stream.open(journalPath, std::ios::binary | std::ios::in | std::ios::out);
+            journal->stream.seekp(0, std::ios::end);
+            for (auto &[_, store] : _storeHouses)
+            {
+                journal->storedProducts.push_back(store->getStoredProductsSize());
+            }
+        }
+        if (!journal->stream)
+        {
+            throw std::runtime_error(std::format("Could not open checkpoint journal {}", journalPath.string()));
+        }
+        _checkpointJournal = std::move(journal);
+    }
+
+    void Factory::writeCheckpoint(const RunOptions &options, size_t time, std::ostream &raportOutStream)
+    {
+        if (_raportWriter)
+        {
+            _raportWriter->flush();
+        }
+        raportOutStream.flush();
+        auto raportOffset = raportOutStream.tellp();
+        CheckpointInfo info{time, std::nullopt};
+        if (raportOffset >= 0)
+        {
+            info.raportOffset = static_cast<uint64_t>(raportOffset);
+        }
+
+        auto &journal = *_checkpointJournal;
+        BinaryWriter journalWriter{journal.stream};
+        size_t index = 0;
+        for (auto &[_, store] : _storeHouses)
+        {
+            auto &storedProducts = journal.storedProducts[index++];
+            store->saveCheckpoint(journalWriter, _latency != nullptr, storedProducts);
+            storedProducts = store->getStoredProductsSize();
+        }
+        journal.stream.flush();
+        if (!journal.stream)
+        {
+            throw std::runtime_error("Could not write checkpoint journal");
+        }
+
+        std::filesystem::path filePath = *options.checkpointFile;
+        auto temporaryPath = filePath;
+        temporaryPath += ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            BinaryWriter writer{file};
+            writeCheckpointState(writer, info, static_cast<uint64_t>(journal.stream.tellp()));
+            for (auto &[id, store] : _storeHouses)
+            {
+                writer.write<uint64_t>(id);
+                writer.write<uint64_t>(store->getStoredProductsSize());
+            }
+            if (!file)
+            {
+                throw std::runtime_error("Could not write checkpoint");
+            }
+        }
+        std::filesystem::rename(temporaryPath, filePath);
+    }
+
+    void Factory::writeCheckpointState(BinaryWriter &writer, const CheckpointInfo &info,
+                                       std::optional<uint64_t> journalSize) const
+    {
+        writer.write(checkpointMagic);
+        writer.write(checkpointVersion);
+        writer.write<uint64_t>(info.time);
+        writer.write<uint64_t>(info.raportOffset.value_or(noValue));
+        writer.write<uint64_t>(journalSize.value_or(noValue));
+        writer.write<uint64_t>(getProductIdSeed());
+        writer.writeString(getRandomDevice().saveState());
+
+        writer.write<uint64_t>(_loadingRamps.size());
+        for (auto &[id, ramp] : _loadingRamps)
+        {
+            writer.write<uint64_t>(id);
+            ramp->saveCheckpoint(writer);
+        }
+        writer.write<uint64_t>(_workers.size());
+        for (auto &[id, worker] : _workers)
+        {
+            writer.write<uint64_t>(id);
+            worker->saveCheckpoint(writer, _latency != nullptr);
+        }
+        writer.write<uint8_t>(_deltaTracker != nullptr);
+        if (_deltaTracker)
+        {
+            _deltaTracker->saveCheckpoint(writer);
+        }
+        writer.write<uint8_t>(_latency != nullptr);
+        if (_latency)
+        {
+            _latency->saveCheckpoint(writer);
+        }
+        writer.write<uint64_t>(_storeHouses.size());
+    }
+
+    std::optional<uint64_t> Factory::readCheckpointState(BinaryReader &reader, CheckpointInfo &info)
+    {
+        if (reader.read<uint32_t>() != checkpointMagic)
+        {
+            throw std::runtime_error("Invalid checkpoint file");
+        }
+        if (auto version = reader.read<uint32_t>(); version != checkpointVersion)
+        {
+            throw std::runtime_error(std::format("Unsupported checkpoint version {}", version));
+        }
+        info.time = reader.read<uint64_t>();
+        info.raportOffset = std::nullopt;
+        if (auto raportOffset = reader.read<uint64_t>(); raportOffset != noValue)
+        {
+            info.raportOffset = raportOffset;
+        }
+        std::optional<uint64_t> journalSize;
+        if (auto size = reader.read<uint64_t>(); size != noValue)
+        {
+            journalSize = size;
+        }
+        setProductIdSeed(reader.read<uint64_t>());
+        getRandomDevice().loadState(reader.readString());
+
+        readCheckpointCount(reader, _loadingRamps.size(), "LoadingRamp");
+        for (auto &[id, ramp] : _loadingRamps)
+        {
+            readCheckpointId(reader, id, "LoadingRamp");
+            ramp->loadCheckpoint(reader);
+        }
+        readCheckpointCount(reader, _workers.size(), "Worker");
+        for (auto &[id, worker] : _workers)
+        {
+            readCheckpointId(reader, id, "Worker");
+            worker->loadCheckpoint(reader);
+        }
+        _deltaTracker.reset();
+        if (reader.read<uint8_t>())
+        {
+            _deltaTracker = DeltaRaportTracker::loadCheckpoint(reader);
+        }
+        _latency.reset();
+        if (reader.read<uint8_t>())
+        {
+            _latency = std::make_unique<LatencyTracker>(getWorkersInOrder(), getStoreHousesInOrder());
+            _latency->loadCheckpoint(reader);
+        }
+        readCheckpointCount(reader, _storeHouses.size(), "Storehouse");
+        return journalSize;
+    }
+
+    size_t Factory::getProductIdSeed() const
+    {
+        return _context ? _context->getProductIdSeed() : Product::getIdSeed();
+    }
+
+    void Factory::setProductIdSeed(size_t productIdSeed)
+    {
+        if (_context)
+        {
+            _context->setProductIdSeed(productIdSeed);
+        }
+        else
+        {
+            Product::setIdSeed(productIdSeed);
         }
     }
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,506 @@
+#include <algorithm>
+#include <format>
+#include <map>
+#include <stdexcept>
+
+#include "FactoryEdit.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        // same checks, messages and order as Factory::createLink, with node lookup left to the caller
+        template <class Exists> void checkLinkData(const LinkData &data, Exists exists)
+        {
+            if (data.source.type == NodeType::STORE)
+            {
+                throw std::runtime_error("Storehouse cannot be used as link source.");
+            }
+            if (!exists(data.source))
+            {
+                throw std::runtime_error(
+                    std::format("Could not find {} of id {} to be link source.",
+                                data.source.type == NodeType::RAMP ? "LoadingRamp" : "Worker", data.source.id));
+            }
+            if (data.destination.type == NodeType::RAMP)
+            {
+                throw std::runtime_error("LoadingRamp cannot be used as link destination.");
+            }
+            if (!exists(data.destination))
+            {
+                throw std::runtime_error(std::format(
+                    "Could not find {} of id {} to be link destination.",
+                    data.destination.type == NodeType::STORE ? "Storehouse" : "Worker", data.destination.id));
+            }
+            if (data.source.type == NodeType::RAMP && data.destination.type == NodeType::STORE)
+            {
+                throw std::runtime_error("Cannot bind Ramp and Store.");
+            }
+            if (data.probability <= 0)
+            {
+                throw std::runtime_error("Probability Cannot be set to 0.");
+            }
+        }
+    } // namespace
+
+    struct FactoryEdit::Plan
+    {
+        std::vector<LoadingRampData> loadingRamps;
+        std::vector<WorkerData> workers;
+        std::vector<StoreHouseData> storeHouses;
+        std::vector<LinkData> links;
+
+        std::vector<size_t> removedLoadingRamps;
+        std::vector<size_t> removedWorkers;
+        std::vector<size_t> removedStoreHouses;
+        std::unordered_set<Link *> removedLinks;
+    };
+
+    FactoryEdit::FactoryEdit(Factory &factory) : _factory(factory)
+    {
+    }
+
+    void FactoryEdit::addWorker(const WorkerData &data)
+    {
+        checkNotCommitted();
+        _addedWorkers.emplace_back(_sequence++, data);
+    }
+
+    void FactoryEdit::addLoadingRamp(const LoadingRampData &data)
+    {
+        checkNotCommitted();
+        _addedLoadingRamps.emplace_back(_sequence++, data);
+    }
+
+    void FactoryEdit::addStorehouse(const StoreHouseData &data)
+    {
+        checkNotCommitted();
+        _addedStoreHouses.emplace_back(_sequence++, data);
+    }
+
+    void FactoryEdit::addLink(const LinkData &data)
+    {
+        checkNotCommitted();
+        _addedLinks.emplace_back(_sequence++, data);
+    }
+
+    void FactoryEdit::removeWorker(size_t id)
+    {
+        checkNotCommitted();
+        _removedWorkers[id].push_back(_sequence++);
+    }
+
+    void FactoryEdit::removeLoadingRamp(size_t id)
+    {
+        checkNotCommitted();
+        _removedLoadingRamps[id].push_back(_sequence++);
+    }
+
+    void FactoryEdit::removeStorehouse(size_t id)
+    {
+        checkNotCommitted();
+        _removedStoreHouses[id].push_back(_sequence++);
+    }
+
+    void FactoryEdit::removeLink(size_t id)
+    {
+        checkNotCommitted();
+        _removedLinks[id].push_back(_sequence++);
+    }
+
+    void FactoryEdit::commit()
+    {
+        checkNotCommitted();
+        auto plan = createPlan();
+        checkPlan(plan);
+        applyPlan(plan);
+        _committed = true;
+    }
+
+    void FactoryEdit::checkNotCommitted() const
+    {
+        if (_committed)
+        {
+            throw std::runtime_error("Factory edit was already committed.");
+        }
+    }
+
+    FactoryEdit::Plan FactoryEdit::createPlan() const
+    {
+        Plan plan;
+        auto &factory = _factory;
+        auto keepNodes = [&](const auto &additions, const auto &registry, NodeType type, const char *name,
+                             auto &kept) {
+            auto &removals = getRemovals(type);
+            for (size_t index = 0; index < additions.size(); ++index)
+            {
+                auto &[sequence, data] = additions[index];
+                if (!isRemoved(removals, data.id, sequence))
+                {
+                    kept.push_back(data);
+                    continue;
+                }
+                // an addition cancelled by a later removal is dropped, but it still had to be unique when called
+                auto alive = registry.contains(data.id) && !isRemovedBetween(removals, data.id, 0, sequence);
+                for (size_t other = 0; other < index && !alive; ++other)
+                {
+                    auto &[otherSequence, otherData] = additions[other];
+                    alive = otherData.id == data.id && !isRemovedBetween(removals, data.id, otherSequence, sequence);
+                }
+                if (alive)
+                {
+                    throw std::runtime_error(std::format("{} of id {} was already created.", name, data.id));
+                }
+            }
+        };
+        keepNodes(_addedLoadingRamps, factory._loadingRamps, NodeType::RAMP, "Loading ramp", plan.loadingRamps);
+        keepNodes(_addedWorkers, factory._workers, NodeType::WORKER, "Worker", plan.workers);
+        keepNodes(_addedStoreHouses, factory._storeHouses, NodeType::STORE, "Storehouse", plan.storeHouses);
+
+        // links are checked against the nodes live when called, as createLink would be in order
+        auto isLiveNode = [&](const LinkBind &bind, size_t sequence) {
+            auto &removals = getRemovals(bind.type);
+            auto isAdded = [&](const auto &additions) {
+                return std::ranges::any_of(additions, [&](const auto &addition) {
+                    auto &[additionSequence, data] = addition;
+                    return data.id == bind.id && additionSequence < sequence &&
+                           !isRemovedBetween(removals, bind.id, additionSequence, sequence);
+                });
+            };
+            auto registered = bind.type == NodeType::RAMP     ? factory._loadingRamps.contains(bind.id)
+                              : bind.type == NodeType::WORKER ? factory._workers.contains(bind.id)
+                                                              : factory._storeHouses.contains(bind.id);
+            if (registered && !isRemovedBetween(removals, bind.id, 0, sequence))
+            {
+                return true;
+            }
+            return bind.type == NodeType::RAMP     ? isAdded(_addedLoadingRamps)
+                   : bind.type == NodeType::WORKER ? isAdded(_addedWorkers)
+                                                   : isAdded(_addedStoreHouses);
+        };
+        auto isLinkRemovedBetween = [&](size_t id, const LinkBind &source, const LinkBind &destination, size_t from,
+                                        size_t to) {
+            return isRemovedBetween(_removedLinks, id, from, to) ||
+                   isRemovedBetween(getRemovals(source.type), source.id, from, to) ||
+                   isRemovedBetween(getRemovals(destination.type), destination.id, from, to);
+        };
+        for (size_t index = 0; index < _addedLinks.size(); ++index)
+        {
+            auto &[sequence, data] = _addedLinks[index];
+            checkLinkData(data, [&](const LinkBind &bind) { return isLiveNode(bind, sequence); });
+            // every link must be unique among the links live when called, even if a later removal drops it
+            auto alive = false;
+            if (auto existing = factory._links.find(data.id))
+            {
+                auto &source = existing->getSource();
+                auto &destination = existing->getDestination();
+                alive = !isLinkRemovedBetween(data.id, {source.getId(), source.getNodeType()},
+                                              {destination.getId(), destination.getNodeType()}, 0, sequence);
+            }
+            for (size_t other = 0; other < index && !alive; ++other)
+            {
+                auto &[otherSequence, otherData] = _addedLinks[other];
+                alive = otherData.id == data.id && !isLinkRemovedBetween(data.id, otherData.source,
+                                                                         otherData.destination, otherSequence,
+                                                                         sequence);
+            }
+            if (alive)
+            {
+                throw std::runtime_error(std::format("Link of id {} was already created.", data.id));
+            }
+            if (!isRemoved(_removedLinks, data.id, sequence) &&
+                !isRemoved(getRemovals(data.source.type), data.source.id, sequence) &&
+                !isRemoved(getRemovals(data.destination.type), data.destination.id, sequence))
+            {
+                plan.links.push_back(data);
+            }
+        }
+
+        auto removeLinks = [&](const std::vector<Link *> &links) {
+            plan.removedLinks.insert(links.begin(), links.end());
+        };
+        for (auto &[id, _] : _removedLoadingRamps)
+        {
+            if (auto found = factory._loadingRamps.find(id); found != factory._loadingRamps.end())
+            {
+                plan.removedLoadingRamps.push_back(id);
+                removeLinks(found->second->getSourceLinks());
+            }
+        }
+        for (auto &[id, _] : _removedWorkers)
+        {
+            if (auto found = factory._workers.find(id); found != factory._workers.end())
+            {
+                plan.removedWorkers.push_back(id);
+                removeLinks(found->second->getSourceLinks());
+                removeLinks(found->second->getDestinationLinks());
+            }
+        }
+        for (auto &[id, _] : _removedStoreHouses)
+        {
+            if (auto found = factory._storeHouses.find(id); found != factory._storeHouses.end())
+            {
+                plan.removedStoreHouses.push_back(id);
+                removeLinks(found->second->getDestinationLinks());
+            }
+        }
+        for (auto &[id, _] : _removedLinks)
+        {
+            if (auto link = factory._links.find(id))
+            {
+                plan.removedLinks.insert(link);
+            }
+        }
+        return plan;
+    }
+
+    void FactoryEdit::checkPlan(const Plan &plan) const
+    {
+        auto &factory = _factory;
+        auto checkNodes = [&](const auto &added, const auto &registry, NodeType type, const char *name) {
+            std::unordered_set<size_t> ids;
+            for (auto &data : added)
+            {
+                auto registered = registry.contains(data.id) && !isRemovedNode(type, data.id);
+                if (registered || !ids.insert(data.id).second)
+                {
+                    throw std::runtime_error(std::format("{} of id {} was already created.", name, data.id));
+                }
+            }
+            return ids;
+        };
+        auto addedLoadingRamps =
+            checkNodes(plan.loadingRamps, factory._loadingRamps, NodeType::RAMP, "Loading ramp");
+        auto addedWorkers = checkNodes(plan.workers, factory._workers, NodeType::WORKER, "Worker");
+        auto addedStoreHouses = checkNodes(plan.storeHouses, factory._storeHouses, NodeType::STORE, "Storehouse");
+
+        auto isAdded = [&](const LinkBind &bind) {
+            auto &added = bind.type == NodeType::RAMP     ? addedLoadingRamps
+                          : bind.type == NodeType::WORKER ? addedWorkers
+                                                          : addedStoreHouses;
+            return added.contains(bind.id);
+        };
+        auto exists = [&](const LinkBind &bind) {
+            auto registered = bind.type == NodeType::RAMP     ? factory._loadingRamps.contains(bind.id)
+                              : bind.type == NodeType::WORKER ? factory._workers.contains(bind.id)
+                                                              : factory._storeHouses.contains(bind.id);
+            return isAdded(bind) || (registered && !isRemovedNode(bind.type, bind.id));
+        };
+
+        std::unordered_set<size_t> linkIds;
+        for (auto &data : plan.links)
+        {
+            checkLinkData(data, exists);
+            auto existing = factory._links.find(data.id);
+            if ((existing && !plan.removedLinks.contains(existing)) || !linkIds.insert(data.id).second)
+            {
+                throw std::runtime_error(std::format("Link of id {} was already created.", data.id));
+            }
+        }
+
+        // only nodes touched by the edit can change their connections, so only they are validated
+        struct Connections
+        {
+            ptrdiff_t sources = 0;
+            ptrdiff_t destinations = 0;
+        };
+        std::map<std::pair<NodeType, size_t>, Connections> touched;
+        for (auto link : plan.removedLinks)
+        {
+            auto &source = link->getSource();
+            if (!isRemovedNode(source.getNodeType(), source.getId()))
+            {
+                --touched[{source.getNodeType(), source.getId()}].sources;
+            }
+            auto &destination = link->getDestination();
+            if (!isRemovedNode(destination.getNodeType(), destination.getId()))
+            {
+                --touched[{destination.getNodeType(), destination.getId()}].destinations;
+            }
+        }
+        for (auto &data : plan.links)
+        {
+            ++touched[{data.source.type, data.source.id}].sources;
+            ++touched[{data.destination.type, data.destination.id}].destinations;
+        }
+        for (auto &data : plan.loadingRamps)
+        {
+            touched[{NodeType::RAMP, data.id}];
+        }
+        for (auto &data : plan.workers)
+        {
+            touched[{NodeType::WORKER, data.id}];
+        }
+        for (auto &data : plan.storeHouses)
+        {
+            touched[{NodeType::STORE, data.id}];
+        }
+
+        for (auto &[key, connections] : touched)
+        {
+            auto &[type, id] = key;
+            if (isAdded({id, type}))
+            {
+                continue;
+            }
+            SourceNode *source = nullptr;
+            DestinationNode *destination = nullptr;
+            if (type == NodeType::RAMP)
+            {
+                source = factory._loadingRamps.find(id)->second.get();
+            }
+            else if (type == NodeType::WORKER)
+            {
+                auto worker = factory._workers.find(id)->second.get();
+                source = worker;
+                destination = worker;
+            }
+            else
+            {
+                destination = factory._storeHouses.find(id)->second.get();
+            }
+            if (source)
+            {
+                connections.sources += static_cast<ptrdiff_t>(source->getSourceLinks().size());
+            }
+            if (destination)
+            {
+                connections.destinations += static_cast<ptrdiff_t>(destination->getDestinationLinks().size());
+            }
+        }
+        auto validate = [&](NodeType type, auto check) {
+            for (auto found = touched.lower_bound({type, 0}); found != touched.end() && found->first.first == type;
+                 ++found)
+            {
+                check(found->first.second, found->second);
+            }
+        };
+        validate(NodeType::WORKER, [](size_t id, const Connections &connections) {
+            if (connections.sources <= 0)
+            {
+                throw std::runtime_error(std::format("Worker of id {} is not connected as source.", id));
+            }
+            if (connections.destinations <= 0)
+            {
+                throw std::runtime_error(std::format("Worker of id {} is not connected as destination.", id));
+            }
+        });
+        validate(NodeType::RAMP, [](size_t id, const Connections &connections) {
+            if (connections.sources <= 0)
+            {
+                throw std::runtime_error(std::format("Ramp of id {} is not connected as source.", id));
+            }
+        });
+        validate(NodeType::STORE, [](size_t id, const Connections &connections) {
+            if (connections.destinations <= 0)
+            {
+                throw std::runtime_error(std::format("StoreHouse of id {} is not connected as destination.", id));
+            }
+        });
+    }
+
+    void FactoryEdit::applyPlan(const Plan &plan)
+    {
+        auto &factory = _factory;
+        std::unordered_set<SourceNode *> sources;
+        std::unordered_set<DestinationNode *> destinations;
+        for (auto link : plan.removedLinks)
+        {
+            sources.insert(&link->getSource());
+            destinations.insert(&link->getDestination());
+        }
+        std::unordered_set<SourceNode *> normalized;
+        for (auto source : sources)
+        {
+            source->unBindSourceLinks(plan.removedLinks);
+            if (!isRemovedNode(source->getNodeType(), source->getId()))
+            {
+                normalized.insert(source);
+            }
+        }
+        for (auto destination : destinations)
+        {
+            destination->unBindDestinationLinks(plan.removedLinks);
+        }
+
+        for (auto id : plan.removedLoadingRamps)
+        {
+            factory._loadingRamps.erase(factory._loadingRamps.find(id));
+        }
+        for (auto id : plan.removedWorkers)
+        {
+            factory._workers.erase(factory._workers.find(id));
+        }
+        for (auto id : plan.removedStoreHouses)
+        {
+            factory._storeHouses.erase(factory._storeHouses.find(id));
+        }
+        for (auto link : plan.removedLinks)
+        {
+            factory._links.erase(link->getId());
+        }
+
+        factory._loadingRamps.reserve(factory._loadingRamps.size() + plan.loadingRamps.size());
+        factory._workers.reserve(factory._workers.size() + plan.workers.size());
+        factory._storeHouses.reserve(factory._storeHouses.size() + plan.storeHouses.size());
+        factory._links.reserve(factory._links.size() + plan.links.size());
+        for (auto &data : plan.loadingRamps)
+        {
+            factory.addLoadingRamp(data);
+        }
+        for (auto &data : plan.workers)
+        {
+            factory.addWorker(data);
+        }
+        for (auto &data : plan.storeHouses)
+        {
+            factory.addStorehouse(data);
+        }
+        for (auto &data : plan.links)
+        {
+            auto &link = factory.createLink(data);
+            link.getSource().appendSourceLink(link);
+            normalized.insert(&link.getSource());
+        }
+
+        for (auto source : normalized)
+        {
+            source->normalize();
+        }
+    }
+
+    const FactoryEdit::Removals &FactoryEdit::getRemovals(NodeType type) const
+    {
+        switch (type)
+        {
+        case NodeType::RAMP:
+            return _removedLoadingRamps;
+        case NodeType::WORKER:
+            return _removedWorkers;
+        default:
+            return _removedStoreHouses;
+        }
+    }
+
+    bool FactoryEdit::isRemoved(const Removals &removals, size_t id, size_t sequence) const
+    {
+        auto found = removals.find(id);
+        return found != removals.end() && found->second.back() > sequence;
+    }
+
+    bool FactoryEdit::isRemovedBetween(const Removals &removals, size_t id, size_t from, size_t to) const
+    {
+        auto found = removals.find(id);
+        if (found == removals.end())
+        {
+            return false;
+        }
+        auto removal = std::ranges::lower_bound(found->second, from);
+        return removal != found->second.end() && *removal < to;
+    }
+
+    bool FactoryEdit::isRemovedNode(NodeType type, size_t id) const
+    {
+        return getRemovals(type).contains(id);
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,313 @@
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <unordered_map>
+
+#include "FlatFactory.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        constexpr size_t initialQueueCapacity = 16;
+    } // namespace
+
+    FlatFactory::FlatFactory(const Factory &factory) : _context(factory._context.get())
+    {
+        factory.validate();
+
+        for (auto &[id, ramp] : factory._loadingRamps)
+        {
+            if (ramp->isProductReady())
+            {
+                throw std::runtime_error("Factory with products in flight cannot be compiled.");
+            }
+            auto deliveryInterval = ramp->getLoadingRampData().deliveryInterval;
+            auto remainingTime = ramp->getRemainingProcesingTime();
+            _rampIds.push_back(id);
+            _rampDeliveryIntervals.push_back(deliveryInterval);
+            _rampCounters.push_back(deliveryInterval > remainingTime ? deliveryInterval - remainingTime : 0);
+        }
+
+        std::unordered_map<size_t, size_t> workerIndexes;
+        for (auto &[id, worker] : factory._workers)
+        {
+            if (worker->isProductReady() || worker->isProcessingProduct() || worker->areProductsAvailable())
+            {
+                throw std::runtime_error("Factory with products in flight cannot be compiled.");
+            }
+            auto data = worker->getWorkerData();
+            if (data.capacity > 0)
+            {
+                throw std::runtime_error("Factory with bounded queues cannot be compiled.");
+            }
+            workerIndexes.emplace(id, _workerIds.size());
+            _workerIds.push_back(id);
+            _workerProcessingTimes.push_back(data.processingTime);
+            _workerFifo.push_back(data.type == WorkerType::FIFO);
+        }
+        _workerCounters.assign(_workerIds.size(), 0);
+        _workerCurrentProducts.assign(_workerIds.size(), {});
+        _workerReadyProducts.assign(_workerIds.size(), {});
+
+        std::unordered_map<size_t, size_t> storeIndexes;
+        for (auto &[id, store] : factory._storeHouses)
+        {
+            if (store->areProductsAvailable())
+            {
+                throw std::runtime_error("Factory with products in flight cannot be compiled.");
+            }
+            if (store->getCapacity() > 0)
+            {
+                throw std::runtime_error("Factory with bounded queues cannot be compiled.");
+            }
+            storeIndexes.emplace(id, _workerIds.size() + _storeIds.size());
+            _storeIds.push_back(id);
+        }
+
+        auto destinationsCount = _workerIds.size() + _storeIds.size();
+        _queueBuffers.assign(destinationsCount, std::vector<FlatProduct>(initialQueueCapacity));
+        _queueHeads.assign(destinationsCount, 0);
+        _queueSizes.assign(destinationsCount, 0);
+
+        auto getDestinationIndex = [&](Link *link) {
+            auto &destination = link->getDestination();
+            auto &indexes = destination.getNodeType() == NodeType::WORKER ? workerIndexes : storeIndexes;
+            return indexes.at(destination.getId());
+        };
+        auto addSourceLinks = [&](const SourceNode &source) {
+            auto &aliasTable = source.getAliasTable();
+            auto &links = source.getSourceLinks();
+            for (size_t index = 0; index < links.size(); ++index)
+            {
+                _linkDestinations.push_back(getDestinationIndex(links[index]));
+                _linkAliasProbabilities.push_back(aliasTable.getProbabilities()[index]);
+                _linkAliases.push_back(getDestinationIndex(links[aliasTable.getAliases()[index]]));
+            }
+            _linkOffsets.push_back(_linkDestinations.size());
+        };
+
+        _linkOffsets.push_back(0);
+        for (auto &[_, ramp] : factory._loadingRamps)
+        {
+            addSourceLinks(*ramp);
+        }
+        for (auto &[_, worker] : factory._workers)
+        {
+            addSourceLinks(*worker);
+        }
+    }
+
+    void FlatFactory::run(size_t maxIterations, std::ostream &raportOutStream, const Factory::RaportGuard &raportGuard,
+                          IRandomDevice &randomDevice)
+    {
+        _productIdSeed = _context ? _context->getProductIdSeed() : Product::getIdSeed();
+        for (size_t time = 0; time < maxIterations; ++time)
+        {
+            tick(time, randomDevice);
+
+            if (raportGuard.isRaportTime(time))
+            {
+                raportOutStream << std::format("========= Iteration: {} =========", time) << std::endl;
+                raportOutStream << generateStateRaport();
+            }
+        }
+        if (_context)
+        {
+            _context->setProductIdSeed(_productIdSeed);
+        }
+        else
+        {
+            Product::setIdSeed(_productIdSeed);
+        }
+    }
+
+    void FlatFactory::writeState(Factory &factory) const
+    {
+        size_t index = 0;
+        for (auto &[_, ramp] : factory._loadingRamps)
+        {
+            ramp->restore(_rampCounters[index++], false);
+        }
+        index = 0;
+        for (auto &[_, worker] : factory._workers)
+        {
+            if (_workerReadyProducts[index].id != NoProduct)
+            {
+                worker->setProduct(createProduct(*worker, _workerReadyProducts[index]));
+            }
+            auto &currentProduct = _workerCurrentProducts[index];
+            worker->restoreService(currentProduct.id != NoProduct ? createProduct(*worker, currentProduct) : nullptr,
+                                   _workerCounters[index]);
+            writeQueue(*worker, index++);
+        }
+        for (auto &[_, store] : factory._storeHouses)
+        {
+            writeQueue(*store, index++);
+        }
+    }
+
+    void FlatFactory::writeQueue(DestinationNode &node, size_t destination) const
+    {
+        auto &buffer = _queueBuffers[destination];
+        const auto head = _queueHeads[destination];
+        const auto mask = buffer.size() - 1;
+        for (size_t index = 0; index < _queueSizes[destination]; ++index)
+        {
+            node.addProductToStore(createProduct(node, buffer[(head + index) & mask]));
+        }
+    }
+
+    Product::Ptr FlatFactory::createProduct(const Node &node, const FlatProduct &product)
+    {
+        auto created = Product::create(product.id, node.getProductPool());
+        created->setCreationTime(product.creationTime);
+        return created;
+    }
+
+    void FlatFactory::tick(size_t time, IRandomDevice &randomDevice)
+    {
+        const auto rampsCount = _rampIds.size();
+        const auto workersCount = _workerIds.size();
+
+        for (size_t ramp = 0; ramp < rampsCount; ++ramp)
+        {
+            if (++_rampCounters[ramp] >= _rampDeliveryIntervals[ramp])
+            {
+                _rampCounters[ramp] = 0;
+                passProduct(ramp, {_productIdSeed++, time}, randomDevice);
+            }
+        }
+
+        for (size_t worker = 0; worker < workersCount; ++worker)
+        {
+            if (_workerReadyProducts[worker].id != NoProduct)
+            {
+                passProduct(rampsCount + worker, _workerReadyProducts[worker], randomDevice);
+                _workerReadyProducts[worker] = {};
+            }
+        }
+
+        for (size_t worker = 0; worker < workersCount; ++worker)
+        {
+            auto &currentProduct = _workerCurrentProducts[worker];
+            if (currentProduct.id == NoProduct)
+            {
+                if (_queueSizes[worker] == 0)
+                {
+                    continue;
+                }
+                currentProduct = popProduct(worker, _workerFifo[worker]);
+                _workerCounters[worker] = 0;
+            }
+            if (++_workerCounters[worker] >= _workerProcessingTimes[worker])
+            {
+                _workerReadyProducts[worker] = currentProduct;
+                currentProduct = _queueSizes[worker] > 0 ? popProduct(worker, _workerFifo[worker]) : FlatProduct{};
+                _workerCounters[worker] = 0;
+            }
+        }
+    }
+
+    void FlatFactory::passProduct(size_t source, FlatProduct product, IRandomDevice &randomDevice)
+    {
+        pushProduct(getRandomDestination(source, randomDevice.next()), product);
+    }
+
+    size_t FlatFactory::getRandomDestination(size_t source, double probability) const
+    {
+        const auto begin = _linkOffsets[source];
+        const auto end = _linkOffsets[source + 1];
+        if (begin == end)
+        {
+            throw std::runtime_error("No links available");
+        }
+        const auto scaled = probability * static_cast<double>(end - begin);
+        auto link = std::min(static_cast<size_t>(scaled), end - begin - 1);
+        if (scaled - static_cast<double>(link) < _linkAliasProbabilities[begin + link])
+        {
+            return _linkDestinations[begin + link];
+        }
+        return _linkAliases[begin + link];
+    }
+
+    void FlatFactory::pushProduct(size_t destination, FlatProduct product)
+    {
+        auto &buffer = _queueBuffers[destination];
+        auto &head = _queueHeads[destination];
+        auto &size = _queueSizes[destination];
+        if (size == buffer.size())
+        {
+            std::vector<FlatProduct> grown(buffer.size() * 2);
+            for (size_t index = 0; index < size; ++index)
+            {
+                grown[index] = buffer[(head + index) & (buffer.size() - 1)];
+            }
+            buffer.swap(grown);
+            head = 0;
+        }
+        buffer[(head + size) & (buffer.size() - 1)] = product;
+        ++size;
+    }
+
+    FlatFactory::FlatProduct FlatFactory::popProduct(size_t destination, bool first)
+    {
+        auto &buffer = _queueBuffers[destination];
+        auto &head = _queueHeads[destination];
+        auto &size = _queueSizes[destination];
+        const auto mask = buffer.size() - 1;
+        FlatProduct product;
+        if (first)
+        {
+            product = buffer[head];
+            head = (head + 1) & mask;
+        }
+        else
+        {
+            product = buffer[(head + size - 1) & mask];
+        }
+        --size;
+        return product;
+    }
+
+    std::string FlatFactory::generateStateRaport() const
+    {
+        std::string out = "== WORKERS ==\n\n";
+        auto inserter = std::back_inserter(out);
+        for (size_t worker = 0; worker < _workerIds.size(); ++worker)
+        {
+            std::format_to(inserter, "WORKER #{}\n\tQueue: ", _workerIds[worker]);
+            if (_workerCurrentProducts[worker].id != NoProduct)
+            {
+                std::format_to(inserter, "#{} (pt = {}), ", _workerCurrentProducts[worker].id,
+                               _workerCounters[worker]);
+            }
+            appendQueue(out, worker);
+            out += "\n\n";
+        }
+        out += "== STOREHOUSES ==\n\n";
+        for (size_t store = 0; store < _storeIds.size(); ++store)
+        {
+            std::format_to(inserter, "STOREHOUSE #{}\n\tQueue: ", _storeIds[store]);
+            appendQueue(out, _workerIds.size() + store);
+            out += "\n\n";
+        }
+        return out;
+    }
+
+    void FlatFactory::appendQueue(std::string &out, size_t destination) const
+    {
+        auto &buffer = _queueBuffers[destination];
+        const auto head = _queueHeads[destination];
+        const auto size = _queueSizes[destination];
+        const auto mask = buffer.size() - 1;
+        for (size_t index = 0; index < size; ++index)
+        {
+            if (index > 0)
+            {
+                out += ", ";
+            }
+            std::format_to(std::back_inserter(out), "#{}", buffer[(head + index) & mask].id);
+        }
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+
+#include "LatencyTracker.hpp"
+#include "StoreHouse.hpp"
+#include "TextRaportSink.hpp"
+#include "Worker.hpp"
+
+namespace sd
+{
+    void LatencyStatistic::add(uint64_t value)
+    {
+        ++count;
+        sum += value;
+        max = std::max(max, value);
+    }
+
+    double LatencyStatistic::getMean() const
+    {
+        return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+    }
+
+    LatencyTracker::LatencyTracker(const std::vector<Worker *> &workers, const std::vector<StoreHouse *> &storeHouses,
+                                   size_t startTime)
+        : _time(startTime)
+    {
+        _workers.reserve(workers.size());
+        for (auto worker : workers)
+        {
+            _workers.emplace_back(worker->getId(), NodeLatency{});
+        }
+        _storeHouses.reserve(storeHouses.size());
+        for (auto store : storeHouses)
+        {
+            _storeHouses.emplace_back(store->getId(), NodeLatency{});
+        }
+        std::ranges::sort(_workers, {}, &Entries::value_type::first);
+        std::ranges::sort(_storeHouses, {}, &Entries::value_type::first);
+    }
+
+    void LatencyTracker::setTime(size_t time)
+    {
+        _time = time;
+    }
+
+    size_t LatencyTracker::getTime() const
+    {
+        return _time;
+    }
+
+    NodeLatency &LatencyTracker::getWorkerLatency(size_t id)
+    {
+        return const_cast<NodeLatency &>(find(_workers, id, "Worker"));
+    }
+
+    NodeLatency &LatencyTracker::getStoreHouseLatency(size_t id)
+    {
+        return const_cast<NodeLatency &>(find(_storeHouses, id, "Storehouse"));
+    }
+
+    const NodeLatency &LatencyTracker::getWorkerLatency(size_t id) const
+    {
+        return find(_workers, id, "Worker");
+    }
+
+    const NodeLatency &LatencyTracker::getStoreHouseLatency(size_t id) const
+    {
+        return find(_storeHouses, id, "Storehouse");
+    }
+
+    void LatencyTracker::recordHop(NodeLatency *source, NodeLatency *destination, bool toStoreHouse, Product &product)
+    {
+        if (source)
+        {
+            source->sojourn.add(_time - product.getEnqueueTime());
+        }
+        product.setEnqueueTime(_time);
+        if (destination && toStoreHouse)
+        {
+            auto sojourn = _time - product.getCreationTime();
+            auto service = std::min<size_t>(product.getServiceTime(), sojourn);
+            destination->sojourn.add(sojourn);
+            destination->waiting.add(sojourn - service);
+            destination->service.add(service);
+        }
+    }
+
+    void LatencyTracker::recordServiceStart(NodeLatency &worker, const Product &product, size_t startTime)
+    {
+        worker.waiting.add(startTime - product.getEnqueueTime());
+    }
+
+    void LatencyTracker::recordServiceEnd(NodeLatency &worker, Product &product, size_t serviceTime)
+    {
+        worker.service.add(serviceTime);
+        product.addServiceTime(serviceTime);
+    }
+
+    void LatencyTracker::writeRaport(IRaportSink &sink) const
+    {
+        sink.beginLatencyRaport();
+        auto write = [&](NodeType type, size_t id, const NodeLatency &latency) {
+            sink.beginNode(0, type, id);
+            sink.writeLatency(1, "Sojourn", latency.sojourn);
+            sink.writeLatency(1, "Waiting", latency.waiting);
+            sink.writeLatency(1, "Service", latency.service);
+            sink.endNode();
+        };
+
+        sink.beginSection("WORKERS");
+        for (auto &[id, latency] : _workers)
+        {
+            write(NodeType::WORKER, id, latency);
+        }
+        sink.beginSection("STOREHOUSES");
+        for (auto &[id, latency] : _storeHouses)
+        {
+            write(NodeType::STORE, id, latency);
+        }
+    }
+
+    std::string LatencyTracker::generateRaport() const
+    {
+        std::string out;
+        TextRaportSink sink{out};
+        writeRaport(sink);
+        return out;
+    }
+
+    void LatencyTracker::saveCheckpoint(BinaryWriter &writer) const
+    {
+        for (auto entries : {&_workers, &_storeHouses})
+        {
+            writer.write<uint64_t>(entries->size());
+            for (auto &[id, latency] : *entries)
+            {
+                writer.write<uint64_t>(id);
+                writer.write(latency);
+            }
+        }
+    }
+
+    void LatencyTracker::loadCheckpoint(BinaryReader &reader)
+    {
+        for (auto entries : {&_workers, &_storeHouses})
+        {
+            if (reader.read<uint64_t>() != entries->size())
+            {
+                throw std::runtime_error("Latency checkpoint does not match factory structure");
+            }
+            for (auto &[id, latency] : *entries)
+            {
+                if (reader.read<uint64_t>() != id)
+                {
+                    throw std::runtime_error("Latency checkpoint does not match factory structure");
+                }
+                latency = reader.read<NodeLatency>();
+            }
+        }
+    }
+
+    const NodeLatency &LatencyTracker::find(const Entries &entries, size_t id, const char *name)
+    {
+        auto found = std::ranges::lower_bound(entries, id, {}, &Entries::value_type::first);
+        if (found == entries.end() || found->first != id)
+        {
+            throw std::runtime_error(std::format("{} of id {} has no latency statistics", name, id));
+        }
+        return found->second;
+    }
+} // namespace sd
\ No newline at end of file
@@ -50,19 +50,19 @@ namespace sd
         _probability = newProbability;
     }
 
-    std::string Link::getStructureRaport(size_t offset) const
+    void Link::writeStructureRaport(IRaportSink &sink, size_t offset) const
     {
-        return std::format("{}{} (p = {:.2f})", getOffset(offset), _destination.toString(), getProbability());
+        sink.writeLink(offset, _destination.getNodeType(), _destination.getId(), getProbability());
     }
 
     void Link::unBindSource()
     {
-        _source.unBindSourceLink(getId());
+        _source.unBindSourceLink(*this);
     }
 
     void Link::unBindDestination()
     {
-        _destination.unBindDestinationLink(getId());
+        _destination.unBindDestinationLink(*this);
     }
 
     SourceNode &Link::getSource()
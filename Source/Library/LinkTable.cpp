@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <format>
+
+#include "LinkTable.hpp"
+
+namespace sd
+{
+    Link &LinkTable::emplace(const LinkData &data, SourceNode &source, DestinationNode &destination)
+    {
+        Link link{data, source, destination};
+        auto index = _freeIndexes.empty() ? _links.size() : _freeIndexes.back();
+        if (!_indexes.emplace(data.id, index).second)
+        {
+            throw std::runtime_error(std::format("Link of id {} was already created.", data.id));
+        }
+        Link *created = nullptr;
+        if (index == _links.size())
+        {
+            created = &_links.emplace_back(link).value();
+        }
+        else
+        {
+            _freeIndexes.pop_back();
+            created = &_links[index].emplace(link);
+        }
+        auto position = std::upper_bound(_order.begin(), _order.end(), data.id,
+                                         [](size_t id, const Link *link) { return id < link->getId(); });
+        _order.insert(position, created);
+        return *created;
+    }
+
+    Link *LinkTable::find(size_t id)
+    {
+        auto found = _indexes.find(id);
+        return found == _indexes.end() ? nullptr : &_links[found->second].value();
+    }
+
+    void LinkTable::erase(size_t id)
+    {
+        if (auto found = _indexes.find(id); found != _indexes.end())
+        {
+            auto position = std::lower_bound(_order.begin(), _order.end(), id,
+                                             [](const Link *link, size_t id) { return link->getId() < id; });
+            _order.erase(position);
+            _links[found->second].reset();
+            _freeIndexes.push_back(found->second);
+            _indexes.erase(found);
+        }
+    }
+
+    void LinkTable::reserve(size_t size)
+    {
+        _indexes.reserve(size);
+        _order.reserve(size);
+    }
+
+    size_t LinkTable::size() const
+    {
+        return _indexes.size();
+    }
+
+    bool LinkTable::empty() const
+    {
+        return _indexes.empty();
+    }
+
+    const std::vector<const Link *> &LinkTable::getLinksInOrder() const
+    {
+        return _order;
+    }
+} // namespace sd
\ No newline at end of file
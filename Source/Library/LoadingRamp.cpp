@@ -1,7 +1,9 @@
 #include <format>
 #include <sstream>
 
+#include "EventTrace.hpp"
 #include "LoadingRamp.hpp"
+#include "SimulationContext.hpp"
 
 namespace sd
 {
@@ -14,13 +16,11 @@ namespace sd
     {
     }
 
-    std::string LoadingRamp::getStructureRaport(size_t offset) const
+    void LoadingRamp::writeStructureRaport(IRaportSink &sink, size_t offset) const
     {
-        std::stringstream out;
-        out << getOffset(offset++) << toString() << std::endl;
-        out << getOffset(offset) << "Delivery interval: " << getTotalProcesingTime() << std::endl;
-        out << SourceNode::getStructureRaport(offset);
-        return out.str();
+        sink.beginNode(offset++, getNodeType(), getId());
+        sink.writeProperty(offset, "Delivery interval", getTotalProcesingTime());
+        SourceNode::writeStructureRaport(sink, offset);
     }
 
     std::string LoadingRamp::toString() const
@@ -38,13 +38,50 @@ namespace sd
         return {getId(), getTotalProcesingTime()};
     }
 
+    void LoadingRamp::process(const size_t currentTime)
+    {
+        if (!isBlocked())
+        {
+            _time = currentTime;
+            Processable::process(currentTime);
+        }
+    }
+
+    void LoadingRamp::skip(const size_t ticks)
+    {
+        if (!isBlocked())
+        {
+            Processable::skip(ticks);
+        }
+    }
+
+    void LoadingRamp::saveCheckpoint(BinaryWriter &writer) const
+    {
+        SourceNode::saveCheckpoint(writer);
+        Processable::saveCheckpoint(writer);
+    }
+
+    void LoadingRamp::loadCheckpoint(BinaryReader &reader)
+    {
+        SourceNode::loadCheckpoint(reader);
+        Processable::loadCheckpoint(reader);
+    }
+
     void LoadingRamp::triggerOperation()
     {
-        setProduct(std::move(createProduct()));
+        auto product = createProduct();
+        product->setCreationTime(_time);
+        if (auto trace = getNodeState().trace)
+        {
+            trace->record(EventTrace::PRODUCT_CREATED, product->getId(), getId());
+        }
+        setProduct(std::move(product));
     }
 
     Product::Ptr LoadingRamp::createProduct() const
     {
-        return std::make_unique<Product>();
+        auto &state = getNodeState();
+        return Product::create(state.context ? state.context->createProductId() : Product::generateId(),
+                               state.productPool);
     }
 } // namespace sd
\ No newline at end of file
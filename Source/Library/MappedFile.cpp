@@ -0,0 +1,105 @@
+#include <format>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.hpp"
+
+namespace sd
+{
+    MappedFile::MappedFile(const std::filesystem::path &path) : _path(path)
+    {
+#ifdef _WIN32
+        _file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+        {
+            _file = nullptr;
+        }
+        LARGE_INTEGER size;
+        if (!_file || !GetFileSizeEx(_file, &size))
+#else
+        _file = ::open(path.c_str(), O_RDONLY);
+        struct stat status;
+        if (_file < 0 || ::fstat(_file, &status) != 0)
+#endif
+        {
+            close();
+            throw std::runtime_error(std::format("Could not open file: {}", path.string()));
+        }
+#ifdef _WIN32
+        _size = static_cast<size_t>(size.QuadPart);
+        if (_size > 0)
+        {
+            _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            _data = _mapping ? static_cast<const char *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, _size)) : nullptr;
+        }
+#else
+        _size = static_cast<size_t>(status.st_size);
+        if (_size > 0)
+        {
+            auto data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _file, 0);
+            _data = data == MAP_FAILED ? nullptr : static_cast<const char *>(data);
+        }
+#endif
+        if (_size > 0 && !_data)
+        {
+            close();
+            throw std::runtime_error(std::format("Could not map {} bytes of file: {}", _size, path.string()));
+        }
+    }
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    std::string_view MappedFile::getView() const
+    {
+        return _data ? std::string_view{_data, _size} : std::string_view{};
+    }
+
+    size_t MappedFile::getSize() const
+    {
+        return _size;
+    }
+
+    void MappedFile::close()
+    {
+#ifdef _WIN32
+        if (_data)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping)
+        {
+            CloseHandle(_mapping);
+            _mapping = nullptr;
+        }
+        if (_file)
+        {
+            CloseHandle(_file);
+            _file = nullptr;
+        }
+#else
+        if (_data)
+        {
+            ::munmap(const_cast<char *>(_data), _size);
+        }
+        if (_file >= 0)
+        {
+            ::close(_file);
+            _file = -1;
+        }
+#endif
+        _data = nullptr;
+    }
+} // namespace sd
\ No newline at end of file
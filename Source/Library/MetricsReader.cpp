@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+#include "MetricsReader.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        template <class T> void appendValues(const std::vector<char> &chunk, std::vector<double> &values)
+        {
+            for (size_t offset = 0; offset < chunk.size(); offset += sizeof(T))
+            {
+                T value;
+                std::memcpy(&value, chunk.data() + offset, sizeof(T));
+                values.push_back(static_cast<double>(value));
+            }
+        }
+    } // namespace
+
+    MetricsReader::MetricsReader(const std::filesystem::path &path) : _file(path, std::ios::binary)
+    {
+        if (!_file)
+        {
+            throw std::runtime_error(std::format("Could not open metrics file: {}", path.string()));
+        }
+        readHeader();
+    }
+
+    size_t MetricsReader::getFirstSampleTime() const
+    {
+        return _firstSampleTime;
+    }
+
+    size_t MetricsReader::getInterval() const
+    {
+        return _interval;
+    }
+
+    size_t MetricsReader::getWindow() const
+    {
+        return _window;
+    }
+
+    size_t MetricsReader::getRowTime(size_t row) const
+    {
+        return _firstSampleTime + row * std::max<size_t>(_window, 1) * _interval;
+    }
+
+    const std::vector<MetricsRecorder::Column> &MetricsReader::getColumns() const
+    {
+        return _columns;
+    }
+
+    std::optional<size_t> MetricsReader::findColumn(NodeType nodeType, size_t nodeId,
+                                                    MetricsRecorder::Metric metric) const
+    {
+        auto found = std::find_if(_columns.begin(), _columns.end(), [&](const MetricsRecorder::Column &column) {
+            return column.nodeType == nodeType && column.nodeId == nodeId && column.metric == metric;
+        });
+        if (found == _columns.end())
+        {
+            return std::nullopt;
+        }
+        return found - _columns.begin();
+    }
+
+    std::vector<double> MetricsReader::readColumn(size_t column)
+    {
+        if (column >= _columns.size())
+        {
+            throw std::runtime_error(std::format("Metrics column {} is out of range", column));
+        }
+        const auto metric = _columns[column].metric;
+        const auto valueSize = MetricsRecorder::getValueSize(metric);
+        std::vector<double> values;
+        std::vector<char> chunk;
+        _file.clear();
+        _file.seekg(_dataOffset);
+        BinaryReader reader{_file};
+        while (_file.peek() != std::ifstream::traits_type::eof())
+        {
+            const auto rows = reader.read<uint64_t>();
+            const auto groupOffset = static_cast<std::streamoff>(_file.tellg());
+            chunk.resize(rows * valueSize);
+            _file.seekg(groupOffset + static_cast<std::streamoff>(rows * _columnOffsets[column]));
+            if (!_file.read(chunk.data(), std::streamsize(chunk.size())))
+            {
+                throw std::runtime_error("Metrics file contains truncated row group");
+            }
+            switch (metric)
+            {
+            case MetricsRecorder::QUEUE_LENGTH:
+            case MetricsRecorder::QUEUE_MIN:
+            case MetricsRecorder::QUEUE_MAX:
+                appendValues<uint32_t>(chunk, values);
+                break;
+            case MetricsRecorder::BUSY:
+                appendValues<uint8_t>(chunk, values);
+                break;
+            case MetricsRecorder::QUEUE_MEAN:
+            case MetricsRecorder::BUSY_RATIO:
+                appendValues<float>(chunk, values);
+                break;
+            }
+            _file.seekg(groupOffset + static_cast<std::streamoff>(rows * _rowSize));
+        }
+        return values;
+    }
+
+    void MetricsReader::readHeader()
+    {
+        std::array<char, 4> magic;
+        if (!_file.read(magic.data(), magic.size()) || magic != MetricsRecorder::Magic)
+        {
+            throw std::runtime_error("Metrics file has invalid header");
+        }
+        BinaryReader reader{_file};
+        if (auto version = reader.read<uint8_t>(); version != MetricsRecorder::Version)
+        {
+            throw std::runtime_error(std::format("Unsupported metrics version {}", int{version}));
+        }
+        _firstSampleTime = reader.read<uint64_t>();
+        _interval = reader.read<uint64_t>();
+        _window = reader.read<uint64_t>();
+        _columns.resize(reader.read<uint64_t>());
+        for (auto &column : _columns)
+        {
+            column.nodeType = static_cast<NodeType>(reader.read<uint8_t>());
+            column.nodeId = reader.read<uint64_t>();
+            column.metric = reader.read<MetricsRecorder::Metric>();
+            if (column.metric > MetricsRecorder::BUSY_RATIO)
+            {
+                throw std::runtime_error(std::format("Metrics file contains unknown metric {}", int{column.metric}));
+            }
+            _columnOffsets.push_back(_rowSize);
+            _rowSize += MetricsRecorder::getValueSize(column.metric);
+        }
+        _dataOffset = _file.tellg();
+    }
+} // namespace sd
\ No newline at end of file
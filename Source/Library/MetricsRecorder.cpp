@@ -0,0 +1,237 @@
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <limits>
+
+#include "MetricsRecorder.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        uint32_t toQueueLength(size_t size)
+        {
+            return static_cast<uint32_t>(std::min<size_t>(size, std::numeric_limits<uint32_t>::max()));
+        }
+    } // namespace
+
+    MetricsRecorder::MetricsRecorder(const std::filesystem::path &path, const std::vector<Worker *> &workers,
+                                     const std::vector<StoreHouse *> &storeHouses, size_t startTime, size_t interval,
+                                     size_t window)
+        : _file(path, std::ios::binary | std::ios::trunc), _writer(_file), _interval(interval), _window(window)
+    {
+        if (_interval == 0)
+        {
+            throw std::runtime_error("Metrics interval must be positive");
+        }
+        if (!_file)
+        {
+            throw std::runtime_error(std::format("Could not open metrics file: {}", path.string()));
+        }
+        for (auto worker : workers)
+        {
+            addSource(*worker, worker);
+        }
+        for (auto storeHouse : storeHouses)
+        {
+            addSource(*storeHouse, nullptr);
+        }
+
+        size_t rowSize = 0;
+        for (auto &column : _columns)
+        {
+            rowSize += getValueSize(column.metric);
+        }
+        _rowsPerGroup = std::max<size_t>(1, RowGroupBytes / std::max<size_t>(1, rowSize));
+        _buffers.resize(_columns.size());
+        for (size_t column = 0; column < _columns.size(); ++column)
+        {
+            _buffers[column].reserve(_rowsPerGroup * getValueSize(_columns[column].metric));
+        }
+        _windows.resize(_sources.size());
+
+        _file.write(Magic.data(), Magic.size());
+        _writer.write(Version);
+        _writer.write<uint64_t>(getNextSampleTime(startTime));
+        _writer.write<uint64_t>(_interval);
+        _writer.write<uint64_t>(_window);
+        _writer.write<uint64_t>(_columns.size());
+        for (auto &column : _columns)
+        {
+            _writer.write<uint8_t>(column.nodeType);
+            _writer.write<uint64_t>(column.nodeId);
+            _writer.write(column.metric);
+        }
+    }
+
+    MetricsRecorder::~MetricsRecorder()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    size_t MetricsRecorder::getValueSize(Metric metric)
+    {
+        switch (metric)
+        {
+        case QUEUE_LENGTH:
+        case QUEUE_MIN:
+        case QUEUE_MAX:
+            return sizeof(uint32_t);
+        case BUSY:
+            return sizeof(uint8_t);
+        case QUEUE_MEAN:
+        case BUSY_RATIO:
+            return sizeof(float);
+        }
+        throw std::runtime_error(std::format("Unknown metric {}", int{metric}));
+    }
+
+    bool MetricsRecorder::isSampleTime(size_t time) const
+    {
+        return time % _interval == 0;
+    }
+
+    size_t MetricsRecorder::getNextSampleTime(size_t time) const
+    {
+        return (time + _interval - 1) / _interval * _interval;
+    }
+
+    const std::vector<MetricsRecorder::Column> &MetricsRecorder::getColumns() const
+    {
+        return _columns;
+    }
+
+    void MetricsRecorder::sample()
+    {
+        if (_window == 0)
+        {
+            size_t column = 0;
+            for (auto &source : _sources)
+            {
+                appendValue(column++, toQueueLength(source.node->getStoredProductsSize()));
+                if (source.worker)
+                {
+                    appendValue<uint8_t>(column++, source.worker->isProcessingProduct());
+                }
+            }
+            appendRow();
+            return;
+        }
+
+        const bool first = _windowSamples == 0;
+        for (size_t index = 0; index < _sources.size(); ++index)
+        {
+            auto &source = _sources[index];
+            auto &window = _windows[index];
+            auto size = toQueueLength(source.node->getStoredProductsSize());
+            window.min = first ? size : std::min(window.min, size);
+            window.max = first ? size : std::max(window.max, size);
+            window.sum = (first ? 0 : window.sum) + size;
+            window.busy = (first ? 0 : window.busy) + (source.worker && source.worker->isProcessingProduct());
+        }
+        if (++_windowSamples == _window)
+        {
+            appendRow();
+        }
+    }
+
+    void MetricsRecorder::close()
+    {
+        if (_closed)
+        {
+            return;
+        }
+        _closed = true;
+        if (_windowSamples > 0)
+        {
+            appendRow();
+        }
+        flushRowGroup();
+        _file.close();
+        if (!_file)
+        {
+            throw std::runtime_error("Could not write metrics file");
+        }
+    }
+
+    void MetricsRecorder::addSource(const DestinationNode &node, const Worker *worker)
+    {
+        _sources.push_back({&node, worker});
+        const auto type = node.getNodeType();
+        const auto id = node.getId();
+        if (_window == 0)
+        {
+            _columns.push_back({type, id, QUEUE_LENGTH});
+            if (worker)
+            {
+                _columns.push_back({type, id, BUSY});
+            }
+            return;
+        }
+        _columns.push_back({type, id, QUEUE_MIN});
+        _columns.push_back({type, id, QUEUE_MAX});
+        _columns.push_back({type, id, QUEUE_MEAN});
+        if (worker)
+        {
+            _columns.push_back({type, id, BUSY_RATIO});
+        }
+    }
+
+    template <class T> void MetricsRecorder::appendValue(size_t column, T value)
+    {
+        auto &buffer = _buffers[column];
+        auto offset = buffer.size();
+        buffer.resize(offset + sizeof(T));
+        std::memcpy(buffer.data() + offset, &value, sizeof(T));
+    }
+
+    void MetricsRecorder::appendRow()
+    {
+        if (_window > 0)
+        {
+            const auto samples = static_cast<float>(_windowSamples);
+            size_t column = 0;
+            for (size_t index = 0; index < _sources.size(); ++index)
+            {
+                auto &window = _windows[index];
+                appendValue(column++, window.min);
+                appendValue(column++, window.max);
+                appendValue(column++, static_cast<float>(window.sum) / samples);
+                if (_sources[index].worker)
+                {
+                    appendValue(column++, static_cast<float>(window.busy) / samples);
+                }
+            }
+            _windowSamples = 0;
+        }
+        if (++_rows == _rowsPerGroup)
+        {
+            flushRowGroup();
+        }
+    }
+
+    void MetricsRecorder::flushRowGroup()
+    {
+        if (_rows == 0)
+        {
+            return;
+        }
+        _writer.write<uint64_t>(_rows);
+        for (auto &buffer : _buffers)
+        {
+            _file.write(buffer.data(), std::streamsize(buffer.size()));
+            buffer.clear();
+        }
+        _rows = 0;
+        if (!_file)
+        {
+            throw std::runtime_error("Could not write metrics file");
+        }
+    }
+} // namespace sd
\ No newline at end of file
@@ -1,14 +1,59 @@
+#include <algorithm>
+#include <format>
 #include <sstream>
 
+#include "EventTrace.hpp"
+#include "LatencyTracker.hpp"
 #include "Node.hpp"
 #include "Random.hpp"
+#include "SimulationContext.hpp"
 
 namespace sd
 {
+    IRandomDevice &NodeState::getRandomDevice() const
+    {
+        if (context)
+        {
+            return context->getRandomDevice();
+        }
+        return Random::get();
+    }
+
     Node::Node(size_t id) : Identifiable(id)
     {
     }
 
+    void Node::setContext(SimulationContext *context)
+    {
+        _state.context = context;
+    }
+
+    void Node::setProductPool(ProductPool *productPool)
+    {
+        _state.productPool = productPool;
+    }
+
+    void Node::setTrace(EventTrace *trace)
+    {
+        _state.trace = trace;
+    }
+
+    void Node::setLatency(LatencyTracker *tracker, NodeLatency *latency)
+    {
+        _state.latencyTracker = tracker;
+        _state.latency = latency;
+    }
+
+    Product::Ptr Node::acquireProduct(size_t id) const
+    {
+        return Product::create(id, _state.productPool);
+    }
+
+    IRandomDevice &Node::getRandomDevice() const
+    {
+        return _state.getRandomDevice();
+    }
+
     SourceNode::SourceNode(size_t id) : Node(id)
     {
     }
@@ -22,48 +67,109 @@ namespace sd
         _product = std::move(product);
     }
 
-    void SourceNode::passProduct()
+    DestinationNode *SourceNode::passProduct()
+    {
+        return passProduct(getState());
+    }
+
+    DestinationNode *SourceNode::passProduct(const NodeState &state)
     {
         if (!isProductReady())
         {
-            return;
+            return nullptr;
         }
-        auto link = getRandomLink();
-        if (!link)
+        if (_links.empty())
         {
             throw std::runtime_error("No links available");
         }
-        link->getDestination().addProductToStore(std::move(_product));
+        auto &link = _blockedLink ? *_blockedLink : selectLink(state.getRandomDevice().next());
+        if (link.getDestination().isFull())
+        {
+            _blockedLink = &link;
+            return nullptr;
+        }
+        _blockedLink = nullptr;
+        return &deliverProduct(link, releaseProduct(), state);
     }
 
-    std::string SourceNode::getStructureRaport(size_t offset) const
+    Link &SourceNode::selectLink(double propability) const
     {
-        std::stringstream out;
-        out << getOffset(offset++) << "Receivers:" << std::endl;
+        if (_links.empty())
+        {
+            throw std::runtime_error("No links available");
+        }
+        return getLink(propability);
+    }
+
+    Product::Ptr SourceNode::releaseProduct()
+    {
+        return std::move(_product);
+    }
+
+    DestinationNode &SourceNode::deliverProduct(Link &link, Product::Ptr &&product)
+    {
+        return deliverProduct(link, std::move(product), getState());
+    }
+
+    DestinationNode &SourceNode::deliverProduct(Link &link, Product::Ptr &&product, const NodeState &state)
+    {
+        auto &destination = link.getDestination();
+        auto productId = product->getId();
+        if (auto tracker = state.latencyTracker)
+        {
+            tracker->recordHop(state.latency, destination.getLatency(), destination.getNodeType() == NodeType::STORE,
+                               *product);
+        }
+        destination.addProductToStore(std::move(product));
+        if (auto trace = state.trace)
+        {
+            trace->record(EventTrace::LINK_HOP, productId, link.getId());
+            trace->record(destination.getNodeType() == NodeType::STORE ? EventTrace::STORE_ARRIVAL
+                                                                        : EventTrace::ENQUEUE,
+                          productId, destination.getId(), destination.getStoredProductsSize());
+        }
+        return destination;
+    }
+
+    void SourceNode::writeStructureRaport(IRaportSink &sink, size_t offset) const
+    {
+        sink.beginLinks(offset++);
         for (auto &link : _links)
         {
-            out << link->getStructureRaport(offset);
-            if (link != _links.back())
-            {
-                out << std::endl;
-            }
+            link->writeStructureRaport(sink, offset);
         }
-        return out.str();
     }
 
-    void SourceNode::bindSourceLink(Link::Ptr link)
+    void SourceNode::bindSourceLink(Link &link)
     {
-        _links.emplace_back(link);
+        _links.push_back(&link);
         normalize();
     }
 
-    void SourceNode::unBindSourceLink(size_t id)
+    void SourceNode::appendSourceLink(Link &link)
+    {
+        _links.push_back(&link);
+    }
+
+    void SourceNode::unBindSourceLink(const Link &link)
     {
-        _links.erase(std::remove_if(_links.begin(), _links.end(), [id](Link::Ptr ptr) { return ptr->getId() == id; }),
-                     _links.end());
+        if (_blockedLink == &link)
+        {
+            _blockedLink = nullptr;
+        }
+        std::erase(_links, &link);
         normalize();
     }
 
+    void SourceNode::unBindSourceLinks(const std::unordered_set<Link *> &links)
+    {
+        if (links.contains(_blockedLink))
+        {
+            _blockedLink = nullptr;
+        }
+        std::erase_if(_links, [&](Link *link) { return links.contains(link); });
+    }
+
     bool SourceNode::connectedSources() const
     {
         return !_links.empty();
@@ -77,28 +183,42 @@ namespace sd
         }
     }
 
-    bool SourceNode::isProductReady() const
+    DestinationNode *SourceNode::getBlockedDestination() const
     {
-        return bool{_product};
+        return _blockedLink ? &_blockedLink->getDestination() : nullptr;
     }
 
-    Link::Ptr SourceNode::getRandomLink() const
+    const std::vector<Link *> &SourceNode::getSourceLinks() const
     {
-        if (_links.empty())
-        {
-            return nullptr;
-        }
-        double propability = Random::get().next();
-        double accumulate = 0;
-        for (auto &link : _links)
+        return _links;
+    }
+
+    const AliasTable &SourceNode::getAliasTable() const
+    {
+        return _aliasTable;
+    }
+
+    void SourceNode::saveCheckpoint(BinaryWriter &writer) const
+    {
+        Product::saveCheckpoint(writer, _product);
+        auto blockedLink = std::find(_links.begin(), _links.end(), _blockedLink);
+        writer.write<uint64_t>(blockedLink == _links.end() ? NoLink : blockedLink - _links.begin());
+    }
+
+    void SourceNode::loadCheckpoint(BinaryReader &reader)
+    {
+        _product = Product::loadCheckpoint(reader, getProductPool());
+        auto blockedLink = reader.read<uint64_t>();
+        if (blockedLink != NoLink && blockedLink >= _links.size())
         {
-            accumulate += link->getProbability();
-            if (propability <= accumulate)
-            {
-                return link;
-            }
+            throw std::runtime_error(std::format("Checkpoint blocks {} on missing link", toString()));
         }
-        return _links.back();
+        _blockedLink = blockedLink == NoLink ? nullptr : _links[blockedLink];
+    }
+
+    Link &SourceNode::getLink(double propability) const
+    {
+        return *_links[_aliasTable.sample(propability)];
     }
 
     void SourceNode::normalize()
@@ -109,20 +229,29 @@ namespace sd
         {
             totalPropability += link->getBaseProbability();
         }
+        std::vector<double> probabilities;
+        probabilities.reserve(_links.size());
         for (auto &link : _links)
         {
             auto baseProbability = link->getBaseProbability();
             link->setProbability(baseProbability / totalPropability);
+            probabilities.push_back(link->getProbability());
         }
+        _aliasTable = AliasTable{probabilities};
     }
 
-    DestinationNode::DestinationNode(size_t id) : Node(id)
+    DestinationNode::DestinationNode(size_t id, size_t capacity) : Node(id), _storedProducts(capacity)
     {
     }
 
     void DestinationNode::addProductToStore(Product::Ptr &&product)
     {
-        _storedProducts.emplace_back(std::move(product));
+        if (isFull())
+        {
+            throw std::runtime_error(std::format("Queue of {} is full", toString()));
+        }
+        _storedProducts.push_back(std::move(product));
+        ++_version;
     }
 
     Product::Ptr DestinationNode::getStoredProduct(bool first)
@@ -131,43 +260,31 @@ namespace sd
         {
             throw std::runtime_error("Destination is empty");
         }
-        Product::Ptr result;
-        if (first)
-        {
-            result = std::move(_storedProducts.front());
-            _storedProducts.pop_front();
-        }
-        else
-        {
-            result = std::move(_storedProducts.back());
-            _storedProducts.pop_back();
-        }
-        return std::move(result);
+        ++_version;
+        return first ? _storedProducts.pop_front() : _storedProducts.pop_back();
     }
 
-    std::string DestinationNode::getStateRaport(size_t offset) const
+    void DestinationNode::writeStateRaport(IRaportSink &sink, size_t) const
     {
-        std::stringstream out;
-        for (auto &product : _storedProducts)
+        for (size_t index = 0; index < _storedProducts.size(); ++index)
         {
-            out << product->toString();
-            if (product != _storedProducts.back())
-            {
-                out << ", ";
-            }
+            sink.writeProduct(_storedProducts[index]->getId());
         }
-        return out.str();
     }
 
-    void DestinationNode::bindDestinationLink(Link::Ptr link)
+    void DestinationNode::bindDestinationLink(Link &link)
+    {
+        _links.push_back(&link);
+    }
+
+    void DestinationNode::unBindDestinationLink(const Link &link)
     {
-        _links.emplace_back(link);
+        std::erase(_links, &link);
     }
 
-    void DestinationNode::unBindDestinationLink(size_t id)
+    void DestinationNode::unBindDestinationLinks(const std::unordered_set<Link *> &links)
     {
-        _links.erase(std::remove_if(_links.begin(), _links.end(), [id](Link::Ptr ptr) { return ptr->getId() == id; }),
-                     _links.end());
+        std::erase_if(_links, [&](Link *link) { return links.contains(link); });
     }
 
     bool DestinationNode::connectedDestinations() const
@@ -183,13 +300,100 @@ namespace sd
         }
     }
 
-    bool DestinationNode::areProductsAvailable() const
+    const std::vector<Link *> &DestinationNode::getDestinationLinks() const
     {
-        return getStoredProductsSize() > 0;
+        return _links;
     }
 
-    size_t DestinationNode::getStoredProductsSize() const
+    const Product &DestinationNode::getStoredProductAt(size_t index) const
     {
-        return _storedProducts.size();
+        return *_storedProducts[index];
+    }
+
+    void DestinationNode::appendStoredProductIds(std::vector<uint64_t> &ids, size_t limit) const
+    {
+        const auto end = std::min(limit, _storedProducts.size());
+        for (size_t index = 0; index < end; ++index)
+        {
+            ids.push_back(_storedProducts[index]->getId());
+        }
+    }
+
+    size_t DestinationNode::getCapacity() const
+    {
+        return _storedProducts.capacity();
+    }
+
+    uint64_t DestinationNode::getVersion() const
+    {
+        return _version;
+    }
+
+    void DestinationNode::saveCheckpoint(BinaryWriter &writer, bool latency, size_t first) const
+    {
+        std::vector<uint64_t> ids;
+        std::vector<uint64_t> creationTimes;
+        std::vector<uint64_t> enqueueTimes;
+        std::vector<uint64_t> serviceTimes;
+        ids.reserve(_storedProducts.size() - std::min(first, _storedProducts.size()));
+        creationTimes.reserve(ids.capacity());
+        if (latency)
+        {
+            enqueueTimes.reserve(ids.capacity());
+            serviceTimes.reserve(ids.capacity());
+        }
+        for (auto index = first; index < _storedProducts.size(); ++index)
+        {
+            auto &product = *_storedProducts[index];
+            ids.push_back(product.getId());
+            creationTimes.push_back(product.getCreationTime());
+            if (latency)
+            {
+                enqueueTimes.push_back(product.getEnqueueTime());
+                serviceTimes.push_back(product.getServiceTime());
+            }
+        }
+        // restored as is, so marks of a delta raport tracker loaded with the checkpoint still match
+        writer.write<uint64_t>(_version);
+        writer.writeVector(ids);
+        writer.writeVector(creationTimes);
+        // every record carries its own flag, as journal records of a resumed run may differ from earlier ones
+        writer.write<uint8_t>(latency);
+        if (latency)
+        {
+            writer.writeVector(enqueueTimes);
+            writer.writeVector(serviceTimes);
+        }
+    }
+
+    void DestinationNode::loadCheckpoint(BinaryReader &reader, bool append)
+    {
+        if (!append)
+        {
+            _storedProducts.clear();
+        }
+        auto version = reader.read<uint64_t>();
+        auto ids = reader.readVector<uint64_t>();
+        auto creationTimes = reader.readVector<uint64_t>();
+        auto latency = reader.read<uint8_t>() != 0;
+        auto enqueueTimes = latency ? reader.readVector<uint64_t>() : std::vector<uint64_t>{};
+        auto serviceTimes = latency ? reader.readVector<uint64_t>() : std::vector<uint64_t>{};
+        if (creationTimes.size() != ids.size() ||
+            (latency && (enqueueTimes.size() != ids.size() || serviceTimes.size() != ids.size())))
+        {
+            throw std::runtime_error(std::format("Checkpoint of {} is corrupted", toString()));
+        }
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            auto product = acquireProduct(ids[index]);
+            product->setCreationTime(creationTimes[index]);
+            if (latency)
+            {
+                product->setEnqueueTime(enqueueTimes[index]);
+                product->addServiceTime(serviceTimes[index]);
+            }
+            addProductToStore(std::move(product));
+        }
+        _version = version;
     }
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <algorithm>
+
+#include "ParallelScheduler.hpp"
+
+namespace sd
+{
+    ParallelScheduler::ParallelScheduler(std::vector<LoadingRamp *> ramps, std::vector<Worker *> workers,
+                                         size_t threadsCount, EventTrace *trace)
+        : _ramps(std::move(ramps)), _workers(std::move(workers)),
+          _pool(std::clamp<size_t>(threadsCount, 1, std::max<size_t>(_workers.size(), 1))), _trace(trace)
+    {
+        const auto chunksCount = _pool.getThreadsCount();
+        _chunks.resize(chunksCount);
+        for (size_t index = 0; index < chunksCount; ++index)
+        {
+            auto &chunk = _chunks[index];
+            chunk.begin = _workers.size() * index / chunksCount;
+            chunk.end = _workers.size() * (index + 1) / chunksCount;
+            for (auto worker = chunk.begin; worker < chunk.end; ++worker)
+            {
+                if (_workers[worker]->isProductReady())
+                {
+                    chunk.readyWorkers.push_back(worker);
+                }
+                if (_trace)
+                {
+                    _workers[worker]->setTrace(&chunk.trace);
+                }
+            }
+        }
+        for (auto worker : _workers)
+        {
+            for (auto &link : worker->getSourceLinks())
+            {
+                _bounded = _bounded || link->getDestination().getCapacity() > 0;
+            }
+        }
+    }
+
+    ParallelScheduler::~ParallelScheduler()
+    {
+        for (auto worker : _workers)
+        {
+            worker->setTrace(_trace);
+        }
+    }
+
+    void ParallelScheduler::tick(size_t time)
+    {
+        if (_trace)
+        {
+            _trace->setTime(time);
+        }
+        for (auto ramp : _ramps)
+        {
+            ramp->process(time);
+        }
+        for (auto ramp : _ramps)
+        {
+            ramp->passProduct();
+        }
+
+        if (_bounded)
+        {
+            passFromWorkersInOrder();
+        }
+        else
+        {
+            drawPropabilities();
+            _pool.run([this](size_t thread) { passFromWorkers(_chunks[thread]); });
+            deliverProducts();
+        }
+        mergeTraces();
+
+        _pool.run([this, time](size_t thread) { processWorkers(_chunks[thread], time); });
+        mergeTraces();
+    }
+
+    void ParallelScheduler::drawPropabilities()
+    {
+        for (auto &chunk : _chunks)
+        {
+            for (auto worker : chunk.readyWorkers)
+            {
+                chunk.propabilities.push_back(_workers[worker]->getState().getRandomDevice().next());
+            }
+        }
+    }
+
+    void ParallelScheduler::deliverProducts()
+    {
+        for (auto &chunk : _chunks)
+        {
+            for (auto &[source, link, product] : chunk.deliveries)
+            {
+                source->deliverProduct(*link, std::move(product));
+            }
+            chunk.deliveries.clear();
+        }
+    }
+
+    void ParallelScheduler::mergeTraces()
+    {
+        if (_trace)
+        {
+            for (auto &chunk : _chunks)
+            {
+                _trace->append(chunk.trace);
+            }
+        }
+    }
+
+    void ParallelScheduler::passFromWorkersInOrder()
+    {
+        for (auto &chunk : _chunks)
+        {
+            for (auto worker : chunk.readyWorkers)
+            {
+                _workers[worker]->passProduct();
+            }
+            chunk.readyWorkers.clear();
+        }
+    }
+
+    void ParallelScheduler::passFromWorkers(Chunk &chunk)
+    {
+        for (size_t index = 0; index < chunk.readyWorkers.size(); ++index)
+        {
+            auto &worker = *_workers[chunk.readyWorkers[index]];
+            auto &link = worker.selectLink(chunk.propabilities[index]);
+            chunk.deliveries.push_back({&worker, &link, worker.releaseProduct()});
+        }
+        chunk.readyWorkers.clear();
+        chunk.propabilities.clear();
+    }
+
+    void ParallelScheduler::processWorkers(Chunk &chunk, size_t time)
+    {
+        for (auto worker = chunk.begin; worker < chunk.end; ++worker)
+        {
+            _workers[worker]->process(time);
+            if (_workers[worker]->isProductReady())
+            {
+                chunk.readyWorkers.push_back(worker);
+            }
+        }
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,329 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <format>
+#include <iterator>
+#include <stdexcept>
+
+#include "ParameterSweep.hpp"
+#include "ThreadPool.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        constexpr size_t minColumnWidth = 12;
+
+        ParameterSweep::ParameterTarget parseTarget(const std::string &target, const std::string &definition)
+        {
+            if (target == "worker")
+            {
+                return ParameterSweep::WORKER_PROCESSING_TIME;
+            }
+            if (target == "ramp")
+            {
+                return ParameterSweep::RAMP_DELIVERY_INTERVAL;
+            }
+            if (target == "link")
+            {
+                return ParameterSweep::LINK_PROBABILITY;
+            }
+            throw std::runtime_error(
+                std::format("Sweep parameter: \"{}\", expected target to be one of: worker | ramp | link", definition));
+        }
+
+        // decimal places written in a number, so range values can be rounded to the precision they were given in
+        int getDecimals(const std::string &value)
+        {
+            auto exponent = value.find_first_of("eE");
+            auto mantissa = value.substr(0, exponent);
+            auto point = mantissa.find('.');
+            auto decimals = point == std::string::npos ? 0 : static_cast<int>(mantissa.size() - point - 1);
+            if (exponent != std::string::npos)
+            {
+                decimals -= std::atoi(value.c_str() + exponent + 1);
+            }
+            return std::clamp(decimals, 0, 15);
+        }
+
+        std::vector<double> parseValues(const std::string &values, const std::string &definition)
+        {
+            auto range = splitStr(values, ':');
+            if (range.size() == 3)
+            {
+                auto begin = std::stod(range[0]);
+                auto end = std::stod(range[1]);
+                auto step = std::stod(range[2]);
+                if (step <= 0 || end < begin)
+                {
+                    throw std::runtime_error(
+                        std::format("Sweep parameter: \"{}\", expected range to fit pattern: <from>:<to>:<step>",
+                                    definition));
+                }
+                std::vector<double> result;
+                auto count = static_cast<size_t>(std::floor((end - begin) / step + 1e-9)) + 1;
+                auto scale = std::pow(10.0, std::max(getDecimals(range[0]), getDecimals(range[2])));
+                for (size_t index = 0; index < count; ++index)
+                {
+                    result.push_back(std::round((begin + static_cast<double>(index) * step) * scale) / scale);
+                }
+                return result;
+            }
+            if (range.size() != 1)
+            {
+                throw std::runtime_error(std::format(
+                    "Sweep parameter: \"{}\", expected values to be list <v1>,<v2>... or range <from>:<to>:<step>",
+                    definition));
+            }
+            std::vector<double> result;
+            for (auto &value : splitStr(values, ','))
+            {
+                result.push_back(std::stod(value));
+            }
+            return result;
+        }
+
+        template <class Container> auto &findData(Container &data, size_t id, const std::string &name)
+        {
+            auto found = std::find_if(data.begin(), data.end(), [id](const auto &item) { return item.id == id; });
+            if (found == data.end())
+            {
+                throw std::runtime_error(std::format("Could not find {} of id {} to be swept.", name, id));
+            }
+            return *found;
+        }
+
+        size_t toTime(double value, const std::string &name)
+        {
+            if (value <= 0 || value != std::floor(value))
+            {
+                throw std::runtime_error(std::format("Sweep value {} of {} must be positive integer.", value, name));
+            }
+            return static_cast<size_t>(value);
+        }
+    } // namespace
+
+    ParameterSweep::Parameter ParameterSweep::Parameter::parse(const std::string &definition)
+    {
+        auto invalidPattern = [&definition] {
+            return std::runtime_error(std::format(
+                "Sweep parameter: \"{}\", expected to fit this pattern: <worker|ramp|link>:<id>=<values>", definition));
+        };
+        auto sides = splitStr(definition, '=');
+        auto target = sides.size() == 2 ? splitStr(sides[0], ':') : std::vector<std::string>{};
+        if (target.size() != 2 || sides[1].empty())
+        {
+            throw invalidPattern();
+        }
+        try
+        {
+            Parameter parameter{parseTarget(target[0], definition), std::stoull(target[1]),
+                                parseValues(sides[1], definition)};
+            if (parameter.values.empty())
+            {
+                throw std::runtime_error(
+                    std::format("Sweep parameter: \"{}\", expected at least one value", definition));
+            }
+            return parameter;
+        }
+        catch (const std::invalid_argument &)
+        {
+            throw invalidPattern();
+        }
+        catch (const std::out_of_range &)
+        {
+            throw invalidPattern();
+        }
+    }
+
+    std::string ParameterSweep::Parameter::getName() const
+    {
+        switch (target)
+        {
+        case WORKER_PROCESSING_TIME:
+            return std::format("worker:{}", id);
+        case RAMP_DELIVERY_INTERVAL:
+            return std::format("ramp:{}", id);
+        case LINK_PROBABILITY:
+            return std::format("link:{}", id);
+        }
+        throw std::runtime_error("Unknown sweep parameter");
+    }
+
+    ParameterSweep::ParameterSweep(const Factory &factory, std::vector<Parameter> parameters, size_t replicas,
+                                   uint64_t seed)
+        : _structure(factory.getStructure()), _parameters(std::move(parameters)), _replicas(replicas), _seed(seed)
+    {
+        if (_replicas == 0)
+        {
+            throw std::runtime_error("Replicas count must be positive");
+        }
+        factory.validate();
+        for (auto &parameter : _parameters)
+        {
+            checkParameter(parameter);
+        }
+    }
+
+    void ParameterSweep::run(size_t maxIterations, const RunOptions &options)
+    {
+        auto replicaOptions = options;
+        replicaOptions.threads = 1;
+
+        const auto variantsCount = getVariantsCount();
+        const auto tasksCount = variantsCount * _replicas;
+        std::vector<ReplicationRunner::ReplicaResult> replicaResults(tasksCount);
+        std::atomic<size_t> nextTask = 0;
+        ThreadPool pool{std::min(options.threads, tasksCount)};
+        pool.run([&](size_t) {
+            for (auto task = nextTask++; task < tasksCount; task = nextTask++)
+            {
+                auto replica = task % _replicas;
+                replicaResults[task] = ReplicationRunner::runReplica(createVariant(task / _replicas), _seed, replica,
+                                                                     maxIterations, replicaOptions);
+            }
+        });
+
+        _maxIterations = maxIterations;
+        _results.clear();
+        _results.reserve(variantsCount);
+        for (size_t variant = 0; variant < variantsCount; ++variant)
+        {
+            std::vector<double> throughputs;
+            double queued = 0;
+            double stored = 0;
+            for (size_t replica = 0; replica < _replicas; ++replica)
+            {
+                auto &result = replicaResults[variant * _replicas + replica];
+                throughputs.push_back(result.throughput);
+                for (auto count : result.workerQueueLengths)
+                {
+                    queued += static_cast<double>(count);
+                }
+                for (auto count : result.storeHouseCounts)
+                {
+                    stored += static_cast<double>(count);
+                }
+            }
+            _results.push_back({getVariantValues(variant), ReplicationRunner::computeStatistic(throughputs),
+                                queued / _replicas, stored / _replicas});
+        }
+    }
+
+    size_t ParameterSweep::getVariantsCount() const
+    {
+        size_t count = 1;
+        for (auto &parameter : _parameters)
+        {
+            count *= parameter.values.size();
+        }
+        return count;
+    }
+
+    std::vector<double> ParameterSweep::getVariantValues(size_t variant) const
+    {
+        if (variant >= getVariantsCount())
+        {
+            throw std::runtime_error(std::format("Variant {} is out of range", variant));
+        }
+        std::vector<double> values(_parameters.size());
+        for (auto index = _parameters.size(); index-- > 0;)
+        {
+            auto &parameterValues = _parameters[index].values;
+            values[index] = parameterValues[variant % parameterValues.size()];
+            variant /= parameterValues.size();
+        }
+        return values;
+    }
+
+    FactoryStructure ParameterSweep::createVariant(size_t variant) const
+    {
+        auto structure = _structure;
+        auto values = getVariantValues(variant);
+        for (size_t index = 0; index < _parameters.size(); ++index)
+        {
+            auto &parameter = _parameters[index];
+            switch (parameter.target)
+            {
+            case WORKER_PROCESSING_TIME:
+                findData(structure.workers, parameter.id, "Worker").processingTime =
+                    toTime(values[index], parameter.getName());
+                break;
+            case RAMP_DELIVERY_INTERVAL:
+                findData(structure.loadingRamps, parameter.id, "LoadingRamp").deliveryInterval =
+                    toTime(values[index], parameter.getName());
+                break;
+            case LINK_PROBABILITY:
+                findData(structure.links, parameter.id, "Link").probability = values[index];
+                break;
+            }
+        }
+        return structure;
+    }
+
+    const std::vector<ParameterSweep::VariantResult> &ParameterSweep::getResults() const
+    {
+        return _results;
+    }
+
+    std::string ParameterSweep::generateResultsTable() const
+    {
+        std::string out = "========= Parameter Sweep =========\n";
+        auto inserter = std::back_inserter(out);
+        std::format_to(inserter, "Variants: {}\nReplicas: {}\nIterations: {}\nSeed: {}\n\n", _results.size(),
+                       _replicas, _maxIterations, _seed);
+
+        std::vector<size_t> widths;
+        out += std::format("{:>{}}", "VARIANT", minColumnWidth);
+        for (auto &parameter : _parameters)
+        {
+            auto name = parameter.getName();
+            widths.push_back(std::max(name.size(), minColumnWidth));
+            std::format_to(inserter, " {:>{}}", name, widths.back());
+        }
+        std::format_to(inserter, " {:>{}} {:>{}} {:>{}} {:>{}} {:>{}}\n", "THROUGHPUT", minColumnWidth, "CI LOW",
+                       minColumnWidth, "CI HIGH", minColumnWidth, "QUEUED", minColumnWidth, "STORED", minColumnWidth);
+
+        for (size_t variant = 0; variant < _results.size(); ++variant)
+        {
+            auto &result = _results[variant];
+            std::format_to(inserter, "{:>{}}", variant, minColumnWidth);
+            for (size_t index = 0; index < result.values.size(); ++index)
+            {
+                std::format_to(inserter, " {:>{}}", result.values[index], widths[index]);
+            }
+            std::format_to(inserter, " {:>{}.4f} {:>{}.4f} {:>{}.4f} {:>{}.2f} {:>{}.2f}\n", result.throughput.mean,
+                           minColumnWidth, result.throughput.confidenceLow, minColumnWidth,
+                           result.throughput.confidenceHigh, minColumnWidth, result.queuedProducts, minColumnWidth,
+                           result.storedProducts, minColumnWidth);
+        }
+        return out;
+    }
+
+    void ParameterSweep::checkParameter(const Parameter &parameter) const
+    {
+        for (auto value : parameter.values)
+        {
+            switch (parameter.target)
+            {
+            case WORKER_PROCESSING_TIME:
+                findData(_structure.workers, parameter.id, "Worker");
+                toTime(value, parameter.getName());
+                break;
+            case RAMP_DELIVERY_INTERVAL:
+                findData(_structure.loadingRamps, parameter.id, "LoadingRamp");
+                toTime(value, parameter.getName());
+                break;
+            case LINK_PROBABILITY:
+                findData(_structure.links, parameter.id, "Link");
+                if (value <= 0)
+                {
+                    throw std::runtime_error(
+                        std::format("Sweep value {} of {} must be positive.", value, parameter.getName()));
+                }
+                break;
+            }
+        }
+    }
+} // namespace sd
\ No newline at end of file
@@ -1,6 +1,9 @@
+#include <algorithm>
 #include <format>
+#include <limits>
 
 #include "Product.hpp"
+#include "ProductPool.hpp"
 
 namespace sd
 {
@@ -10,8 +13,116 @@ namespace sd
     {
     }
 
+    Product::Product(size_t id) : Identifiable(id)
+    {
+    }
+
+    Product::Product(size_t id, ProductPool *pool) : Identifiable(id), _pool(pool)
+    {
+    }
+
+    Product::Deleter::Deleter(const std::default_delete<Product> &)
+    {
+    }
+
+    void Product::Deleter::operator()(Product *product) const
+    {
+        if (auto pool = product->_pool)
+        {
+            pool->release(product);
+        }
+        else
+        {
+            delete product;
+        }
+    }
+
     std::string Product::toString() const
     {
         return std::format("#{}", getId());
     }
+
+    size_t Product::getCreationTime() const
+    {
+        return _creationTime;
+    }
+
+    void Product::setCreationTime(size_t creationTime)
+    {
+        _creationTime = creationTime;
+    }
+
+    size_t Product::getEnqueueTime() const
+    {
+        return _creationTime + _enqueueTime;
+    }
+
+    void Product::setEnqueueTime(size_t enqueueTime)
+    {
+        _enqueueTime = saturate(enqueueTime - _creationTime);
+    }
+
+    size_t Product::getServiceTime() const
+    {
+        return _serviceTime;
+    }
+
+    void Product::addServiceTime(size_t serviceTime)
+    {
+        _serviceTime = saturate(size_t{_serviceTime} + serviceTime);
+    }
+
+    uint32_t Product::saturate(size_t value)
+    {
+        return static_cast<uint32_t>(std::min<size_t>(value, std::numeric_limits<uint32_t>::max()));
+    }
+
+    Product::Ptr Product::create(size_t id, ProductPool *pool)
+    {
+        if (pool)
+        {
+            return pool->create(id);
+        }
+        return Ptr{new Product(id)};
+    }
+
+    size_t Product::generateId()
+    {
+        return _idSeed++;
+    }
+
+    size_t Product::getIdSeed()
+    {
+        return _idSeed;
+    }
+
+    void Product::setIdSeed(size_t idSeed)
+    {
+        _idSeed = idSeed;
+    }
+
+    void Product::saveCheckpoint(BinaryWriter &writer, const Ptr &product)
+    {
+        writer.write<uint64_t>(product ? product->getId() : NoProduct);
+        if (product)
+        {
+            writer.write<uint64_t>(product->getCreationTime());
+            writer.write<uint32_t>(product->_enqueueTime);
+            writer.write<uint32_t>(product->_serviceTime);
+        }
+    }
+
+    Product::Ptr Product::loadCheckpoint(BinaryReader &reader, ProductPool *pool)
+    {
+        auto id = reader.read<uint64_t>();
+        if (id == NoProduct)
+        {
+            return nullptr;
+        }
+        auto product = create(id, pool);
+        product->setCreationTime(reader.read<uint64_t>());
+        product->_enqueueTime = reader.read<uint32_t>();
+        product->_serviceTime = reader.read<uint32_t>();
+        return product;
+    }
 } // namespace sd
\ No newline at end of file
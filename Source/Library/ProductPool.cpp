@@ -0,0 +1,44 @@
+#include <new>
+
+#include "ProductPool.hpp"
+
+namespace sd
+{
+    Product::Ptr ProductPool::create(size_t id)
+    {
+        Slot *slot;
+        if (!_freeSlots.empty())
+        {
+            slot = _freeSlots.back();
+            _freeSlots.pop_back();
+        }
+        else
+        {
+            if (_slabUsed == SlabSize)
+            {
+                _slabs.emplace_back(new Slot[SlabSize]);
+                _slabUsed = 0;
+            }
+            slot = &_slabs.back()[_slabUsed++];
+        }
+        ++_liveCount;
+        return Product::Ptr{new (slot->storage) Product(id, this)};
+    }
+
+    void ProductPool::release(Product *product)
+    {
+        product->~Product();
+        _freeSlots.push_back(reinterpret_cast<Slot *>(product));
+        --_liveCount;
+    }
+
+    size_t ProductPool::getLiveCount() const
+    {
+        return _liveCount;
+    }
+
+    size_t ProductPool::getCapacity() const
+    {
+        return _slabs.size() * SlabSize;
+    }
+} // namespace sd
\ No newline at end of file
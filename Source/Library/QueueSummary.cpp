@@ -0,0 +1,42 @@
+#include <algorithm>
+#include <array>
+
+#include "Node.hpp"
+#include "QueueSummary.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        size_t getPercentile(size_t *ages, size_t count, size_t percentile)
+        {
+            auto rank = std::max<size_t>((percentile * count + 99) / 100, 1) - 1;
+            std::nth_element(ages, ages + rank, ages + count);
+            return ages[rank];
+        }
+    } // namespace
+
+    QueueSummary QueueSummary::create(const DestinationNode &node, size_t time)
+    {
+        QueueSummary summary;
+        summary.length = node.getStoredProductsSize();
+        if (summary.length == 0)
+        {
+            return summary;
+        }
+        summary.oldestProduct = node.getStoredProductAt(0).getId();
+        summary.newestProduct = node.getStoredProductAt(summary.length - 1).getId();
+
+        std::array<size_t, SamplesCount> ages;
+        const auto count = std::min(summary.length, SamplesCount);
+        for (size_t sample = 0; sample < count; ++sample)
+        {
+            auto creationTime = node.getStoredProductAt(sample * summary.length / count).getCreationTime();
+            ages[sample] = time > creationTime ? time - creationTime : 0;
+        }
+        summary.ageP50 = getPercentile(ages.data(), count, 50);
+        summary.ageP90 = getPercentile(ages.data(), count, 90);
+        summary.ageP99 = getPercentile(ages.data(), count, 99);
+        return summary;
+    }
+} // namespace sd
\ No newline at end of file
@@ -1,7 +1,30 @@
+#include <sstream>
+
 #include "Random.hpp"
 
 namespace sd
 {
+    namespace
+    {
+        template <class Engine, class Distribution>
+        std::string saveEngineState(const Engine &engine, const Distribution &distribution)
+        {
+            std::ostringstream out;
+            out << engine << ' ' << distribution;
+            return out.str();
+        }
+
+        template <class Engine, class Distribution>
+        void loadEngineState(const std::string &state, Engine &engine, Distribution &distribution)
+        {
+            std::istringstream in(state);
+            if (!(in >> engine >> distribution))
+            {
+                throw std::runtime_error("Invalid random device state");
+            }
+        }
+    } // namespace
+
     NormalRandomDevice::NormalRandomDevice() : _eng(_rd()), _distr(0, 1)
     {
     }
@@ -11,6 +34,38 @@ namespace sd
         return _distr(_eng);
     }
 
+    std::string NormalRandomDevice::saveState() const
+    {
+        return saveEngineState(_eng, _distr);
+    }
+
+    void NormalRandomDevice::loadState(const std::string &state)
+    {
+        loadEngineState(state, _eng, _distr);
+    }
+
+    SeededRandomDevice::SeededRandomDevice(uint64_t seed, uint64_t stream) : _distr(0, 1)
+    {
+        std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32),
+                               static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+        _eng.seed(sequence);
+    }
+
+    double SeededRandomDevice::next()
+    {
+        return _distr(_eng);
+    }
+
+    std::string SeededRandomDevice::saveState() const
+    {
+        return saveEngineState(_eng, _distr);
+    }
+
+    void SeededRandomDevice::loadState(const std::string &state)
+    {
+        loadEngineState(state, _eng, _distr);
+    }
+
     Random::Random(std::unique_ptr<IRandomDevice> newRandomDevice)
     {
         updateRandomDevice(std::move(newRandomDevice));
@@ -27,6 +82,16 @@ namespace sd
         return _randomDevice->next();
     }
 
+    std::string Random::saveState() const
+    {
+        return _randomDevice->saveState();
+    }
+
+    void Random::loadState(const std::string &state)
+    {
+        _randomDevice->loadState(state);
+    }
+
     void Random::updateRandomDevice(std::unique_ptr<IRandomDevice> newRandomDevice)
     {
         _randomDevice = std::move(newRandomDevice);
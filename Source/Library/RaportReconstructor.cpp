@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <format>
+#include <stdexcept>
+
+#include "RaportReconstructor.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        struct RaportHeader
+        {
+            size_t time;
+            bool delta;
+        };
+
+        std::optional<RaportHeader> parseHeader(const std::string &line)
+        {
+            const std::string prefix = "========= Iteration: ";
+            const std::string suffix = " =========";
+            const std::string deltaMark = " (delta)";
+            if (line.size() <= prefix.size() + suffix.size() || !line.starts_with(prefix) || !line.ends_with(suffix))
+            {
+                return std::nullopt;
+            }
+            auto time = line.substr(prefix.size(), line.size() - prefix.size() - suffix.size());
+            auto delta = time.ends_with(deltaMark);
+            if (delta)
+            {
+                time.resize(time.size() - deltaMark.size());
+            }
+            if (time.empty() || !std::all_of(time.begin(), time.end(), [](char c) { return c >= '0' && c <= '9'; }))
+            {
+                return std::nullopt;
+            }
+            return RaportHeader{std::stoull(time), delta};
+        }
+    } // namespace
+
+    RaportReconstructor::RaportReconstructor(std::istream &in, std::ostream &out) : _in(in), _out(out)
+    {
+    }
+
+    void RaportReconstructor::run()
+    {
+        while (peek())
+        {
+            auto line = next();
+            if (auto header = parseHeader(line))
+            {
+                readRaport(header->time, header->delta);
+                writeRaport(header->time);
+            }
+            else
+            {
+                _out << line << '\n';
+            }
+        }
+        _out.flush();
+    }
+
+    void RaportReconstructor::readRaport(size_t time, bool delta)
+    {
+        if (delta && !_initialized)
+        {
+            throw std::runtime_error(std::format("Delta raport of iteration {} has no preceding keyframe", time));
+        }
+        if (!delta)
+        {
+            _workers.clear();
+            _storeHouses.clear();
+            _initialized = true;
+        }
+        expect("== WORKERS ==");
+        expect("");
+        readNodes(_workers, "WORKER #");
+        expect("== STOREHOUSES ==");
+        expect("");
+        readNodes(_storeHouses, "STOREHOUSE #");
+    }
+
+    void RaportReconstructor::readNodes(std::map<size_t, std::string> &nodes, const std::string &prefix)
+    {
+        while (peek() && peek()->starts_with(prefix))
+        {
+            auto id = std::stoull(next().substr(prefix.size()));
+            auto queue = next();
+            if (!queue.starts_with("\tQueue: "))
+            {
+                throw std::runtime_error(std::format("Expected queue in line {}", _lineNumber));
+            }
+            expect("");
+            nodes[id] = std::move(queue);
+        }
+    }
+
+    void RaportReconstructor::writeRaport(size_t time)
+    {
+        _out << std::format("========= Iteration: {} =========\n== WORKERS ==\n\n", time);
+        for (auto &[id, queue] : _workers)
+        {
+            _out << std::format("WORKER #{}\n{}\n\n", id, queue);
+        }
+        _out << "== STOREHOUSES ==\n\n";
+        for (auto &[id, queue] : _storeHouses)
+        {
+            _out << std::format("STOREHOUSE #{}\n{}\n\n", id, queue);
+        }
+    }
+
+    const std::optional<std::string> &RaportReconstructor::peek()
+    {
+        if (!_line)
+        {
+            std::string line;
+            if (std::getline(_in, line))
+            {
+                _line = std::move(line);
+            }
+        }
+        return _line;
+    }
+
+    std::string RaportReconstructor::next()
+    {
+        if (!peek())
+        {
+            throw std::runtime_error("Unexpected end of raport");
+        }
+        auto line = std::move(*_line);
+        _line.reset();
+        ++_lineNumber;
+        return line;
+    }
+
+    void RaportReconstructor::expect(const std::string &line)
+    {
+        if (next() != line)
+        {
+            throw std::runtime_error(std::format("Expected \"{}\" in line {}", line, _lineNumber));
+        }
+    }
+} // namespace sd
\ No newline at end of file
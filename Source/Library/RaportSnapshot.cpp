@@ -0,0 +1,54 @@
+#include "RaportSnapshot.hpp"
+
+namespace sd
+{
+    void RaportSnapshot::clear()
+    {
+        workers.clear();
+        storeHouses.clear();
+        products.clear();
+        summaries.clear();
+        delta = false;
+        summary = false;
+    }
+
+    void RaportSnapshot::replay(IRaportSink &sink) const
+    {
+        sink.beginRaport(time, delta);
+        sink.beginSection("WORKERS");
+        size_t begin = 0;
+        size_t summaryIndex = 0;
+        for (auto &worker : workers)
+        {
+            sink.beginNode(0, NodeType::WORKER, worker.id);
+            sink.beginQueue(1);
+            if (worker.currentProduct != NoProduct)
+            {
+                sink.writeCurrentProduct(worker.currentProduct, worker.processingTime);
+            }
+            replayProducts(sink, begin, worker.productsEnd, summaryIndex++);
+            begin = worker.productsEnd;
+        }
+        sink.beginSection("STOREHOUSES");
+        for (auto &store : storeHouses)
+        {
+            sink.beginNode(0, NodeType::STORE, store.id);
+            sink.beginQueue(1);
+            replayProducts(sink, begin, store.productsEnd, summaryIndex++);
+            begin = store.productsEnd;
+        }
+    }
+
+    void RaportSnapshot::replayProducts(IRaportSink &sink, size_t begin, size_t end, size_t summaryIndex) const
+    {
+        for (auto index = begin; index < end; ++index)
+        {
+            sink.writeProduct(products[index]);
+        }
+        if (summary)
+        {
+            sink.writeQueueSummary(1, summaries[summaryIndex], end - begin);
+        }
+        sink.endNode();
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <format>
+#include <iterator>
+
+#include "Random.hpp"
+#include "ReplicationRunner.hpp"
+#include "ThreadPool.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        // two-sided 95% Student's t quantiles for 1..30 degrees of freedom
+        constexpr std::array<double, 30> studentQuantiles = {
+            12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228, 2.201, 2.179, 2.160, 2.145, 2.131,
+            2.120,  2.110, 2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+        constexpr double normalQuantile = 1.960;
+
+        double getQuantile(size_t degreesOfFreedom)
+        {
+            if (degreesOfFreedom <= studentQuantiles.size())
+            {
+                return studentQuantiles[degreesOfFreedom - 1];
+            }
+            return normalQuantile;
+        }
+
+        std::string toString(const ReplicationRunner::Statistic &statistic)
+        {
+            return std::format("mean = {:.4f}, variance = {:.4f}, 95% CI = [{:.4f}, {:.4f}]", statistic.mean,
+                               statistic.variance, statistic.confidenceLow, statistic.confidenceHigh);
+        }
+    } // namespace
+
+    ReplicationRunner::ReplicationRunner(const Factory &factory, size_t replicas, uint64_t seed)
+        : _structure(factory.getStructure()), _replicas(replicas), _seed(seed)
+    {
+        if (_replicas == 0)
+        {
+            throw std::runtime_error("Replicas count must be positive");
+        }
+        factory.validate();
+    }
+
+    void ReplicationRunner::run(size_t maxIterations, const RunOptions &options)
+    {
+        auto replicaOptions = options;
+        replicaOptions.threads = 1;
+
+        _maxIterations = maxIterations;
+        _results.assign(_replicas, {});
+
+        std::atomic<size_t> nextReplica = 0;
+        ThreadPool pool{std::min(options.threads, _replicas)};
+        pool.run([&](size_t) {
+            for (auto replica = nextReplica++; replica < _replicas; replica = nextReplica++)
+            {
+                _results[replica] = runReplica(_structure, _seed, replica, maxIterations, replicaOptions);
+            }
+        });
+    }
+
+    const std::vector<ReplicationRunner::ReplicaResult> &ReplicationRunner::getResults() const
+    {
+        return _results;
+    }
+
+    std::string ReplicationRunner::generateStatisticsRaport() const
+    {
+        std::string out = "========= Replication Statistics =========\n";
+        auto inserter = std::back_inserter(out);
+        std::format_to(inserter, "Replicas: {}\nIterations: {}\nSeed: {}\n\n", _replicas, _maxIterations, _seed);
+
+        out += "== WORKERS ==\n\n";
+        for (size_t index = 0; index < _structure.workers.size(); ++index)
+        {
+            auto statistic = collectStatistic([index](const ReplicaResult &result) {
+                return result.workerQueueLengths[index];
+            });
+            std::format_to(inserter, "WORKER #{}\n\tQueue length: {}\n\n", _structure.workers[index].id,
+                           toString(statistic));
+        }
+
+        out += "== STOREHOUSES ==\n\n";
+        for (size_t index = 0; index < _structure.storeHouses.size(); ++index)
+        {
+            auto statistic = collectStatistic([index](const ReplicaResult &result) {
+                return result.storeHouseCounts[index];
+            });
+            std::format_to(inserter, "STOREHOUSE #{}\n\tProducts: {}\n\n", _structure.storeHouses[index].id,
+                           toString(statistic));
+        }
+
+        out += "== THROUGHPUT ==\n\n";
+        auto throughput = collectStatistic([](const ReplicaResult &result) { return result.throughput; });
+        std::format_to(inserter, "\tProducts per iteration: {}\n\n", toString(throughput));
+        return out;
+    }
+
+    ReplicationRunner::Statistic ReplicationRunner::computeStatistic(const std::vector<double> &samples)
+    {
+        if (samples.empty())
+        {
+            throw std::runtime_error("Statistic requires at least one sample");
+        }
+        const auto count = static_cast<double>(samples.size());
+        double mean = 0;
+        for (auto sample : samples)
+        {
+            mean += sample;
+        }
+        mean /= count;
+
+        if (samples.size() == 1)
+        {
+            return {mean, 0, mean, mean};
+        }
+        double squares = 0;
+        for (auto sample : samples)
+        {
+            squares += (sample - mean) * (sample - mean);
+        }
+        auto variance = squares / (count - 1);
+        auto halfWidth = getQuantile(samples.size() - 1) * std::sqrt(variance / count);
+        return {mean, variance, mean - halfWidth, mean + halfWidth};
+    }
+
+    SimulationContext::Ptr ReplicationRunner::createReplicaContext(uint64_t seed, size_t replica)
+    {
+        return std::make_shared<SimulationContext>(std::make_unique<SeededRandomDevice>(seed, replica));
+    }
+
+    ReplicationRunner::ReplicaResult ReplicationRunner::runReplica(const FactoryStructure &structure, uint64_t seed,
+                                                                   size_t replica, size_t maxIterations,
+                                                                   const RunOptions &options)
+    {
+        if (options.traceFile)
+        {
+            throw std::runtime_error("Event trace cannot be used for replications");
+        }
+        if (options.metricsFile)
+        {
+            throw std::runtime_error("Metrics cannot be used for replications");
+        }
+        if (options.trackLatency)
+        {
+            throw std::runtime_error("Latency tracking cannot be used for replications");
+        }
+        if (options.checkpointFile)
+        {
+            throw std::runtime_error("Checkpoints cannot be used for replications");
+        }
+        if (options.startTime > 0)
+        {
+            throw std::runtime_error("Resumed simulation cannot be used for replications");
+        }
+        Factory factory{structure};
+        factory.setContext(createReplicaContext(seed, replica));
+
+        auto replicaOptions = options;
+        replicaOptions.structureRaport = false;
+        std::ostream discard{nullptr};
+        factory.run(maxIterations, discard, {size_t{0}}, replicaOptions);
+        return collectResult(factory, maxIterations);
+    }
+
+    ReplicationRunner::ReplicaResult ReplicationRunner::collectResult(const Factory &factory, size_t maxIterations)
+    {
+        ReplicaResult result;
+        result.workerQueueLengths.reserve(factory._workers.size());
+        for (auto &[_, worker] : factory._workers)
+        {
+            result.workerQueueLengths.push_back(worker->getStoredProductsSize());
+        }
+        size_t delivered = 0;
+        result.storeHouseCounts.reserve(factory._storeHouses.size());
+        for (auto &[_, store] : factory._storeHouses)
+        {
+            result.storeHouseCounts.push_back(store->getStoredProductsSize());
+            delivered += store->getStoredProductsSize();
+        }
+        result.throughput = maxIterations > 0 ? static_cast<double>(delivered) / maxIterations : 0;
+        return result;
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include <stdexcept>
+
+#include "SimulationContext.hpp"
+
+namespace sd
+{
+    SimulationContext::SimulationContext(std::unique_ptr<IRandomDevice> randomDevice, size_t productIdSeed)
+        : _randomDevice(std::move(randomDevice)), _productIdSeed(productIdSeed)
+    {
+        if (!_randomDevice)
+        {
+            throw std::runtime_error("Simulation context requires random device");
+        }
+    }
+
+    IRandomDevice &SimulationContext::getRandomDevice() const
+    {
+        return *_randomDevice;
+    }
+
+    size_t SimulationContext::createProductId()
+    {
+        return _productIdSeed++;
+    }
+
+    size_t SimulationContext::getProductIdSeed() const
+    {
+        return _productIdSeed;
+    }
+
+    void SimulationContext::setProductIdSeed(size_t productIdSeed)
+    {
+        _productIdSeed = productIdSeed;
+    }
+} // namespace sd
\ No newline at end of file
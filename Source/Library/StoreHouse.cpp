@@ -6,26 +6,29 @@
 
 namespace sd
 {
-    StoreHouse::StoreHouse(size_t id) : DestinationNode(id), Node(id)
+    StoreHouse::StoreHouse(size_t id, size_t capacity) : DestinationNode(id, capacity), Node(id)
     {
     }
 
-    StoreHouse::StoreHouse(const StoreHouseData &data) : StoreHouse(data.id)
+    StoreHouse::StoreHouse(const StoreHouseData &data) : StoreHouse(data.id, data.capacity)
     {
     }
 
-    std::string StoreHouse::getStructureRaport(size_t offset) const
+    void StoreHouse::writeStructureRaport(IRaportSink &sink, size_t offset) const
     {
-        return toString();
+        sink.beginNode(offset, getNodeType(), getId());
+        if (getCapacity() > 0)
+        {
+            sink.writeProperty(offset + 1, "Queue capacity", getCapacity());
+        }
     }
 
-    std::string StoreHouse::getStateRaport(size_t offset) const
+    void StoreHouse::writeStateRaport(IRaportSink &sink, size_t offset) const
     {
-        std::stringstream out;
-        out << getOffset(offset) << toString() << std::endl;
-        out << getOffset(++offset) << "Queue: " << DestinationNode::getStateRaport(offset);
-        return out.str();
-    };
+        sink.beginNode(offset, getNodeType(), getId());
+        sink.beginQueue(++offset);
+        DestinationNode::writeStateRaport(sink, offset);
+    }
 
     std::string StoreHouse::toString() const
     {
@@ -39,6 +42,6 @@ namespace sd
 
     const StoreHouseData StoreHouse::getStoreHouseData() const
     {
-        return {getId()};
+        return {getId(), getCapacity()};
     }
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+#include "BinaryStream.hpp"
+#include "StructureFile.hpp"
+#include "StructureParser.hpp"
+#include "Utils.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        template <class T> std::vector<T> readColumn(BinaryReader &reader, size_t size)
+        {
+            auto column = reader.readVector<T>();
+            if (column.size() != size)
+            {
+                throw std::runtime_error("Structure file is corrupted");
+            }
+            return column;
+        }
+
+        NodeType toNodeType(uint8_t value)
+        {
+            if (value > static_cast<uint8_t>(NodeType::STORE))
+            {
+                throw std::runtime_error("Structure file is corrupted");
+            }
+            return static_cast<NodeType>(value);
+        }
+    } // namespace
+
+    void StructureFile::save(const Factory &factory, const std::filesystem::path &path)
+    {
+        if (path.extension() == BinaryExtension)
+        {
+            std::ofstream file{path, std::ios::binary};
+            write(file, factory.getStructure());
+        }
+        else
+        {
+            std::ofstream file{path};
+            file << factory;
+        }
+    }
+
+    void StructureFile::load(Factory &factory, const std::filesystem::path &path)
+    {
+        if (isBinary(path))
+        {
+            std::ifstream file{path, std::ios::binary};
+            factory.addStructure(read(file));
+        }
+        else
+        {
+            StructureParser{factory}.parseFile(path);
+        }
+    }
+
+    bool StructureFile::isBinary(const std::filesystem::path &path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        std::array<char, 4> magic;
+        return file.read(magic.data(), magic.size()) && magic == Magic;
+    }
+
+    void StructureFile::write(std::ostream &out, const FactoryStructure &structure)
+    {
+        BinaryWriter writer{out};
+        out.write(Magic.data(), Magic.size());
+        writer.write(Version);
+
+        std::vector<uint64_t> ids, values, capacities;
+        for (auto &ramp : structure.loadingRamps)
+        {
+            ids.push_back(ramp.id);
+            values.push_back(ramp.deliveryInterval);
+        }
+        writer.writeVector(ids);
+        writer.writeVector(values);
+
+        std::vector<uint8_t> types;
+        ids.clear();
+        values.clear();
+        for (auto &worker : structure.workers)
+        {
+            ids.push_back(worker.id);
+            values.push_back(worker.processingTime);
+            types.push_back(static_cast<uint8_t>(worker.type));
+            capacities.push_back(worker.capacity);
+        }
+        writer.writeVector(ids);
+        writer.writeVector(values);
+        writer.writeVector(types);
+        writer.writeVector(capacities);
+
+        ids.clear();
+        capacities.clear();
+        for (auto &store : structure.storeHouses)
+        {
+            ids.push_back(store.id);
+            capacities.push_back(store.capacity);
+        }
+        writer.writeVector(ids);
+        writer.writeVector(capacities);
+
+        std::vector<double> probabilities;
+        std::vector<uint8_t> sourceTypes, destinationTypes;
+        std::vector<uint64_t> sourceIds, destinationIds;
+        ids.clear();
+        for (auto &link : structure.links)
+        {
+            ids.push_back(link.id);
+            probabilities.push_back(link.probability);
+            sourceTypes.push_back(static_cast<uint8_t>(link.source.type));
+            sourceIds.push_back(link.source.id);
+            destinationTypes.push_back(static_cast<uint8_t>(link.destination.type));
+            destinationIds.push_back(link.destination.id);
+        }
+        writer.writeVector(ids);
+        writer.writeVector(probabilities);
+        writer.writeVector(sourceTypes);
+        writer.writeVector(sourceIds);
+        writer.writeVector(destinationTypes);
+        writer.writeVector(destinationIds);
+    }
+
+    FactoryStructure StructureFile::read(std::istream &in)
+    {
+        BinaryReader reader{in, "Structure file is corrupted"};
+        std::array<char, 4> magic;
+        if (!in.read(magic.data(), magic.size()) || magic != Magic)
+        {
+            throw std::runtime_error("Structure file has invalid header");
+        }
+        if (auto version = reader.read<uint8_t>(); version != Version)
+        {
+            throw std::runtime_error(std::format("Unsupported structure file version {}", version));
+        }
+
+        FactoryStructure structure;
+        auto ids = reader.readVector<uint64_t>();
+        auto values = readColumn<uint64_t>(reader, ids.size());
+        structure.loadingRamps.reserve(ids.size());
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            structure.loadingRamps.push_back({ids[index], values[index]});
+        }
+
+        ids = reader.readVector<uint64_t>();
+        values = readColumn<uint64_t>(reader, ids.size());
+        auto types = readColumn<uint8_t>(reader, ids.size());
+        auto capacities = readColumn<uint64_t>(reader, ids.size());
+        structure.workers.reserve(ids.size());
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            if (types[index] > static_cast<uint8_t>(WorkerType::FIFO))
+            {
+                throw std::runtime_error("Structure file is corrupted");
+            }
+            structure.workers.push_back(
+                {ids[index], values[index], static_cast<WorkerType>(types[index]), capacities[index]});
+        }
+
+        ids = reader.readVector<uint64_t>();
+        capacities = readColumn<uint64_t>(reader, ids.size());
+        structure.storeHouses.reserve(ids.size());
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            structure.storeHouses.push_back({ids[index], capacities[index]});
+        }
+
+        ids = reader.readVector<uint64_t>();
+        auto probabilities = readColumn<double>(reader, ids.size());
+        auto sourceTypes = readColumn<uint8_t>(reader, ids.size());
+        auto sourceIds = readColumn<uint64_t>(reader, ids.size());
+        auto destinationTypes = readColumn<uint8_t>(reader, ids.size());
+        auto destinationIds = readColumn<uint64_t>(reader, ids.size());
+        structure.links.reserve(ids.size());
+        for (size_t index = 0; index < ids.size(); ++index)
+        {
+            structure.links.push_back({ids[index],
+                                       probabilities[index],
+                                       {sourceIds[index], toNodeType(sourceTypes[index])},
+                                       {destinationIds[index], toNodeType(destinationTypes[index])}});
+        }
+        return structure;
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,632 @@
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <format>
+#include <limits>
+#include <span>
+#include <string>
+#include <unordered_map>
+
+#include "MappedFile.hpp"
+#include "StructureParser.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        constexpr std::string_view linkPattern =
+            "LINK id=<id> src=<type>-<id> dest=<type>-<id> p=<probability>, where id is unique indentificator, <type> "
+            "is one of following: ramp/worker/store and <probability> is in range <0:1>";
+        constexpr std::string_view workPattern =
+            "WORKER id=<worker-id> processing-time=<processing-time> queue-type=<queuetype>, where id is unique "
+            "indentificator, <processing-time> number grather than zero describing time of processing the product by "
+            "worker and <queue-type> 0 - LIFO, 1 - FIFO describind worker processing mode, optional "
+            "capacity=<capacity> limits worker queue size";
+        constexpr std::string_view rampPattern =
+            "LOADING_RAMP id=<ramp-id> delivery-interval=<delivery-interval>, where id is unique indentificator, "
+            "<delivery-interval> number grather than zero describing time of delivering the product by ramp";
+        constexpr std::string_view storePattern =
+            "STOREHOUSE id=<storehouse-id>, where id is unique indentificator, optional capacity=<capacity> limits "
+            "storehouse size";
+
+        using Words = std::span<const std::string_view>;
+
+        struct Parts
+        {
+            size_t count = 0;
+            std::array<std::string_view, 2> values;
+        };
+
+        Parts splitParts(std::string_view text, char separator)
+        {
+            Parts parts;
+            for (size_t begin = 0; begin < text.size();)
+            {
+                auto end = std::min(text.find(separator, begin), text.size());
+                if (parts.count < parts.values.size())
+                {
+                    parts.values[parts.count] = text.substr(begin, end - begin);
+                }
+                ++parts.count;
+                begin = end + 1;
+            }
+            return parts;
+        }
+
+        void splitWords(std::string_view line, std::vector<std::string_view> &words)
+        {
+            words.clear();
+            for (size_t begin = 0; begin < line.size();)
+            {
+                auto end = std::min(line.find(' ', begin), line.size());
+                words.push_back(line.substr(begin, end - begin));
+                begin = end + 1;
+            }
+        }
+
+        bool isDigit(char character)
+        {
+            return character >= '0' && character <= '9';
+        }
+
+        size_t toUnsigned(std::string_view text)
+        {
+            size_t value = 0;
+            if (!text.empty() && isDigit(text.front()))
+            {
+                auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+                if (error == std::errc{})
+                {
+                    return value;
+                }
+            }
+            return std::stoull(std::string{text});
+        }
+
+        int toInt(std::string_view text)
+        {
+            int value = 0;
+            if (!text.empty() && isDigit(text.front()))
+            {
+                auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+                if (error == std::errc{})
+                {
+                    return value;
+                }
+            }
+            return std::stoi(std::string{text});
+        }
+
+        double toDouble(std::string_view text)
+        {
+            double value = 0;
+            if (!text.empty() && (isDigit(text.front()) || text.front() == '.'))
+            {
+                auto last = text.data() + text.size();
+                auto [end, error] = std::from_chars(text.data(), last, value);
+                auto category = std::fpclassify(value);
+                if (error == std::errc{} && category != FP_ZERO && category != FP_SUBNORMAL &&
+                    (end == last || (*end != 'x' && *end != 'X')))
+                {
+                    return value;
+                }
+            }
+            return std::stod(std::string{text});
+        }
+
+        [[noreturn]] void throwPattern(std::string_view pattern)
+        {
+            throw std::runtime_error(std::format("Expected this line to fit this pattern: {}", pattern));
+        }
+
+        void checkSize(size_t actual, size_t min, size_t max, std::string_view pattern)
+        {
+            if (actual < min || actual > max)
+            {
+                throwPattern(pattern);
+            }
+        }
+
+        size_t getCapacity(std::string_view word)
+        {
+            auto parts = splitParts(word, '=');
+            if (parts.count != 2 || toUnsigned(parts.values[1]) == 0)
+            {
+                throw std::runtime_error(
+                    std::format("Sentence: \"{}\", expected to fit this pattern: capacity=<capacity>, where "
+                                "<capacity> is number grather than zero",
+                                word));
+            }
+            return toUnsigned(parts.values[1]);
+        }
+
+        size_t getId(std::string_view word)
+        {
+            auto parts = splitParts(word, '=');
+            if (parts.count != 2)
+            {
+                throw std::runtime_error(std::format("Sentence: \"{}\", expected to fit this pattern: id=<id>, where "
+                                                     "<id> is idenfificator number grather than zero",
+                                                     word));
+            }
+            return toUnsigned(parts.values[1]);
+        }
+
+        std::string_view getValue(std::string_view word, std::string_view pattern)
+        {
+            auto parts = splitParts(word, '=');
+            if (parts.count != 2)
+            {
+                throw std::runtime_error(
+                    std::format("Sentence: \"{}\", expected to fit this pattern: {}", word, pattern));
+            }
+            return parts.values[1];
+        }
+
+        LinkBind getLinkBind(std::string_view word, std::string_view option, std::string_view types)
+        {
+            auto throwBind = [&]() {
+                throw std::runtime_error(std::format("Sentence: \"{}\", expected to fit this pattern: {}=type-id, "
+                                                     "where type is one of {} and id is identifier",
+                                                     word, option, types));
+            };
+            LinkBind result;
+            auto parts = splitParts(word, '-');
+            if (parts.count != 2)
+            {
+                throwBind();
+            }
+
+            if (parts.values[0].ends_with("ramp"))
+            {
+                result.type = NodeType::RAMP;
+            }
+            else if (parts.values[0].ends_with("worker"))
+            {
+                result.type = NodeType::WORKER;
+            }
+            else if (parts.values[0].ends_with("store"))
+            {
+                result.type = NodeType::STORE;
+            }
+            else
+            {
+                throwBind();
+            }
+            result.id = toUnsigned(parts.values[1]);
+            return result;
+        }
+
+        void define(bool &def, std::string_view option)
+        {
+            if (def)
+            {
+                throw std::runtime_error(std::format("This option was already provided: {}", option));
+            }
+            def = true;
+        }
+
+        void checkDefine(bool def, std::string_view option)
+        {
+            if (!def)
+            {
+                throw std::runtime_error(std::format("This option was not provided: {}", option));
+            }
+        }
+
+        LinkData parseLink(Words input)
+        {
+            checkSize(input.size(), 4, 4, linkPattern);
+
+            LinkData result;
+            bool scrCheck = false, destCheck = false, idCheck = false, pCheck = false;
+            for (auto word : input)
+            {
+                if (word.starts_with("id="))
+                {
+                    result.id = getId(word);
+                    define(idCheck, word);
+                }
+                else if (word.starts_with("src="))
+                {
+                    result.source = getLinkBind(word, "src", "ramp, worker");
+                    define(scrCheck, word);
+                }
+                else if (word.starts_with("dest="))
+                {
+                    result.destination = getLinkBind(word, "dest", "store, worker");
+                    define(destCheck, word);
+                }
+                else if (word.starts_with("p"))
+                {
+                    auto parts = splitParts(word, '=');
+                    result.probability = toDouble(parts.values[1]);
+                    define(pCheck, word);
+                }
+                else
+                {
+                    throwPattern(linkPattern);
+                }
+            }
+
+            checkDefine(scrCheck, "source");
+            checkDefine(idCheck, "id");
+            checkDefine(destCheck, "destination");
+            checkDefine(pCheck, "probability");
+            return result;
+        }
+
+        WorkerData parseWorker(Words input)
+        {
+            checkSize(input.size(), 3, 4, workPattern);
+
+            WorkerData result;
+            bool processCheck = false, idCheck = false, typeCheck = false, capacityCheck = false;
+            for (auto word : input)
+            {
+                if (word.starts_with("processing-time="))
+                {
+                    result.processingTime = toUnsigned(getValue(word, "processing-time=<processing-time>"));
+                    define(processCheck, word);
+                }
+                else if (word.starts_with("id="))
+                {
+                    result.id = getId(word);
+                    define(idCheck, word);
+                }
+                else if (word.starts_with("queue-type="))
+                {
+                    auto value = getValue(word, "queue-type=<queuetype>");
+                    if (value == "FIFO")
+                    {
+                        result.type = WorkerType::FIFO;
+                    }
+                    else if (value == "LIFO")
+                    {
+                        result.type = WorkerType::LIFO;
+                    }
+                    else
+                    {
+                        throw std::runtime_error(std::format(
+                            "Sentence: \"{}\", expected to fit this pattern: queue-type=<queuetype>", word));
+                    }
+                    define(typeCheck, word);
+                }
+                else if (word.starts_with("capacity="))
+                {
+                    result.capacity = getCapacity(word);
+                    define(capacityCheck, word);
+                }
+                else
+                {
+                    throwPattern(workPattern);
+                }
+            }
+            checkDefine(processCheck, "processing-time");
+            checkDefine(idCheck, "id");
+            checkDefine(typeCheck, "queue-type");
+            return result;
+        }
+
+        LoadingRampData parseLoadingRamp(Words input)
+        {
+            checkSize(input.size(), 2, 2, rampPattern);
+
+            LoadingRampData result;
+            bool deliveryCheck = false, idCheck = false;
+            for (auto word : input)
+            {
+                if (word.starts_with("delivery-interval="))
+                {
+                    result.deliveryInterval = toInt(getValue(word, "delivery-interval=<delivery-interval>"));
+                    define(deliveryCheck, word);
+                }
+                else if (word.starts_with("id="))
+                {
+                    result.id = getId(word);
+                    define(idCheck, word);
+                }
+                else
+                {
+                    throwPattern(rampPattern);
+                }
+            }
+            checkDefine(idCheck, "id");
+            checkDefine(deliveryCheck, "delivery-interval");
+            return result;
+        }
+
+        StoreHouseData parseStoreHouse(Words input)
+        {
+            checkSize(input.size(), 1, 2, storePattern);
+
+            StoreHouseData result;
+            bool idCheck = false, capacityCheck = false;
+            for (auto word : input)
+            {
+                if (word.starts_with("id="))
+                {
+                    result.id = getId(word);
+                    define(idCheck, word);
+                }
+                else if (word.starts_with("capacity="))
+                {
+                    result.capacity = getCapacity(word);
+                    define(capacityCheck, word);
+                }
+                else
+                {
+                    throwPattern(storePattern);
+                }
+            }
+            checkDefine(idCheck, "id");
+            return result;
+        }
+
+        template <class Data> struct Entry
+        {
+            size_t line;
+            Data data;
+        };
+
+        template <class Function> bool runLine(size_t line, std::string &error, Function &&function)
+        {
+            try
+            {
+                function();
+                return true;
+            }
+            catch (std::exception &e)
+            {
+                error = std::format("Error in line {}: {}", line, e.what());
+            }
+            catch (...)
+            {
+                error = std::format("Unexpected error in line {}", line);
+            }
+            return false;
+        }
+
+        std::string_view getNodeName(NodeType type)
+        {
+            switch (type)
+            {
+            case NodeType::RAMP:
+                return "LoadingRamp";
+            case NodeType::WORKER:
+                return "Worker";
+            case NodeType::STORE:
+                return "Storehouse";
+            }
+            return "";
+        }
+    } // namespace
+
+    struct StructureParser::Chunk
+    {
+        std::string_view text;
+        size_t firstLine = 0;
+
+        std::vector<Entry<LoadingRampData>> loadingRamps;
+        std::vector<Entry<WorkerData>> workers;
+        std::vector<Entry<StoreHouseData>> storeHouses;
+        std::vector<Entry<LinkData>> links;
+
+        size_t errorLine = std::numeric_limits<size_t>::max();
+        std::string error;
+
+        void parse()
+        {
+            std::vector<std::string_view> words;
+            auto line = firstLine;
+            for (size_t begin = 0; begin < text.size(); ++line)
+            {
+                auto end = std::min(text.find('\n', begin), text.size());
+                if (!runLine(line, error, [&] { parseLine(text.substr(begin, end - begin), line, words); }))
+                {
+                    errorLine = line;
+                    return;
+                }
+                begin = end + 1;
+            }
+        }
+
+        void parseLine(std::string_view content, size_t line, std::vector<std::string_view> &words)
+        {
+            if (content.empty() || content.front() == ';')
+            {
+                return;
+            }
+
+            splitWords(content, words);
+            if (words.empty())
+            {
+                return;
+            }
+            auto keyword = words.front();
+            auto input = Words{words}.subspan(1);
+            if (keyword == "WORKER")
+            {
+                workers.push_back({line, parseWorker(input)});
+            }
+            else if (keyword == "LOADING_RAMP")
+            {
+                loadingRamps.push_back({line, parseLoadingRamp(input)});
+            }
+            else if (keyword == "STOREHOUSE")
+            {
+                storeHouses.push_back({line, parseStoreHouse(input)});
+            }
+            else if (keyword == "LINK")
+            {
+                links.push_back({line, parseLink(input)});
+            }
+            else
+            {
+                throw std::runtime_error("Expected word: WORKER | LOADING_RAMP | STOREHOUSE | LINK");
+            }
+        }
+    };
+
+    StructureParser::StructureParser(Factory &factory, size_t threads)
+        : _factory(factory), _threads(std::max<size_t>(threads, 1))
+    {
+    }
+
+    void StructureParser::parse(std::string_view text)
+    {
+        addChunks(parseChunks(text));
+    }
+
+    void StructureParser::parseFile(const std::filesystem::path &path)
+    {
+        MappedFile file{path};
+        parse(file.getView());
+    }
+
+    std::vector<StructureParser::Chunk> StructureParser::parseChunks(std::string_view text) const
+    {
+        auto chunksCount = std::clamp<size_t>(text.size() / MinChunkSize, 1, _threads);
+        std::vector<Chunk> chunks(chunksCount);
+        size_t begin = 0, line = 0;
+        for (size_t index = 0; index < chunksCount; ++index)
+        {
+            auto end = text.size();
+            if (index + 1 < chunksCount)
+            {
+                auto found = text.find('\n', std::max(begin, text.size() / chunksCount * (index + 1)));
+                end = found == std::string_view::npos ? text.size() : found + 1;
+            }
+            chunks[index].text = text.substr(begin, end - begin);
+            chunks[index].firstLine = line;
+            line += static_cast<size_t>(std::count(text.begin() + begin, text.begin() + end, '\n'));
+            begin = end;
+        }
+
+        if (chunksCount == 1)
+        {
+            chunks.front().parse();
+        }
+        else
+        {
+            ThreadPool{chunksCount}.run([&](size_t thread) { chunks[thread].parse(); });
+        }
+        return chunks;
+    }
+
+    void StructureParser::addChunks(const std::vector<Chunk> &chunks)
+    {
+        auto errorLine = std::numeric_limits<size_t>::max();
+        std::string error;
+        for (auto &chunk : chunks)
+        {
+            if (chunk.errorLine < errorLine)
+            {
+                errorLine = chunk.errorLine;
+                error = chunk.error;
+                break;
+            }
+        }
+
+        std::array<size_t, 3> addedEnds;
+        size_t lastNodeLine = 0;
+        auto addNodes = [&](auto entries, NodeType type, auto add) {
+            addedEnds[type] = errorLine;
+            for (auto &chunk : chunks)
+            {
+                for (auto &entry : chunk.*entries)
+                {
+                    if (entry.line >= errorLine)
+                    {
+                        addedEnds[type] = entry.line;
+                        return;
+                    }
+                    if (!runLine(entry.line, error, [&] { add(entry.data); }))
+                    {
+                        errorLine = addedEnds[type] = entry.line;
+                        return;
+                    }
+                    lastNodeLine = std::max(lastNodeLine, entry.line);
+                }
+            }
+        };
+        addNodes(&Chunk::loadingRamps, NodeType::RAMP, [this](auto &data) { _factory.addLoadingRamp(data); });
+        addNodes(&Chunk::workers, NodeType::WORKER, [this](auto &data) { _factory.addWorker(data); });
+        addNodes(&Chunk::storeHouses, NodeType::STORE, [this](auto &data) { _factory.addStorehouse(data); });
+
+        std::array<std::unordered_map<size_t, size_t>, 3> nodeLines;
+        bool nodeLinesFilled = false;
+        auto fillNodeLines = [&](auto entries, NodeType type) {
+            for (auto &chunk : chunks)
+            {
+                for (auto &entry : chunk.*entries)
+                {
+                    if (entry.line >= addedEnds[type])
+                    {
+                        return;
+                    }
+                    nodeLines[type].emplace(entry.data.id, entry.line);
+                }
+            }
+        };
+        auto isDefinedAfter = [&](const LinkBind &bind, size_t line) {
+            if (line > lastNodeLine)
+            {
+                return false;
+            }
+            if (!nodeLinesFilled)
+            {
+                fillNodeLines(&Chunk::loadingRamps, NodeType::RAMP);
+                fillNodeLines(&Chunk::workers, NodeType::WORKER);
+                fillNodeLines(&Chunk::storeHouses, NodeType::STORE);
+                nodeLinesFilled = true;
+            }
+            auto found = nodeLines[bind.type].find(bind.id);
+            return found != nodeLines[bind.type].end() && found->second > line;
+        };
+        auto addLink = [&](const LinkData &data, size_t line) {
+            if (data.source.type != NodeType::STORE)
+            {
+                if (isDefinedAfter(data.source, line))
+                {
+                    throw std::runtime_error(std::format("Could not find {} of id {} to be link source.",
+                                                         getNodeName(data.source.type), data.source.id));
+                }
+                auto sourceExists = data.source.type == NodeType::RAMP ? _factory._loadingRamps.contains(data.source.id)
+                                                                      : _factory._workers.contains(data.source.id);
+                if (sourceExists && data.destination.type != NodeType::RAMP && isDefinedAfter(data.destination, line))
+                {
+                    throw std::runtime_error(std::format("Could not find {} of id {} to be link destination.",
+                                                         getNodeName(data.destination.type), data.destination.id));
+                }
+            }
+            auto &link = _factory.createLink(data);
+            link.getSource().appendSourceLink(link);
+        };
+
+        [&]() {
+            for (auto &chunk : chunks)
+            {
+                for (auto &entry : chunk.links)
+                {
+                    if (entry.line >= errorLine)
+                    {
+                        return;
+                    }
+                    if (!runLine(entry.line, error, [&] { addLink(entry.data, entry.line); }))
+                    {
+                        errorLine = entry.line;
+                        return;
+                    }
+                }
+            }
+        }();
+        _factory.normalizeSources();
+
+        if (!error.empty())
+        {
+            throw std::runtime_error(error);
+        }
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include <format>
+#include <iterator>
+
+#include "LatencyTracker.hpp"
+#include "QueueSummary.hpp"
+#include "TextRaportSink.hpp"
+
+namespace sd
+{
+    TextRaportSink::TextRaportSink(std::string &out) : _out(out)
+    {
+    }
+
+    void TextRaportSink::beginRaport(size_t time, bool delta)
+    {
+        std::format_to(std::back_inserter(_out), "========= Iteration: {}{} =========\n", time,
+                       delta ? " (delta)" : "");
+    }
+
+    void TextRaportSink::beginSection(std::string_view title)
+    {
+        std::format_to(std::back_inserter(_out), "== {} ==\n\n", title);
+    }
+
+    void TextRaportSink::beginNode(size_t offset, NodeType type, size_t id)
+    {
+        _out.append(offset, '\t');
+        std::format_to(std::back_inserter(_out), "{} #{}", getNodeName(type), id);
+    }
+
+    void TextRaportSink::writeProperty(size_t offset, std::string_view name, size_t value)
+    {
+        _out += '\n';
+        _out.append(offset, '\t');
+        std::format_to(std::back_inserter(_out), "{}: {}", name, value);
+    }
+
+    void TextRaportSink::writeProperty(size_t offset, std::string_view name, std::string_view value)
+    {
+        _out += '\n';
+        _out.append(offset, '\t');
+        std::format_to(std::back_inserter(_out), "{}: {}", name, value);
+    }
+
+    void TextRaportSink::beginLinks(size_t offset)
+    {
+        _out += '\n';
+        _out.append(offset, '\t');
+        _out += "Receivers:\n";
+        _separate = false;
+    }
+
+    void TextRaportSink::writeLink(size_t offset, NodeType type, size_t id, double probability)
+    {
+        if (_separate)
+        {
+            _out += '\n';
+        }
+        _out.append(offset, '\t');
+        std::format_to(std::back_inserter(_out), "{} #{} (p = {:.2f})", getNodeName(type), id, probability);
+        _separate = true;
+    }
+
+    void TextRaportSink::beginQueue(size_t offset)
+    {
+        _out += '\n';
+        _out.append(offset, '\t');
+        _out += "Queue: ";
+        _separate = false;
+    }
+
+    void TextRaportSink::writeCurrentProduct(uint64_t id, size_t processingTime)
+    {
+        std::format_to(std::back_inserter(_out), "#{} (pt = {}), ", id, processingTime);
+    }
+
+    void TextRaportSink::writeProduct(uint64_t id)
+    {
+        if (_separate)
+        {
+            _out += ", ";
+        }
+        std::format_to(std::back_inserter(_out), "#{}", id);
+        _separate = true;
+    }
+
+    void TextRaportSink::writeQueueSummary(size_t offset, const QueueSummary &summary, size_t listedProducts)
+    {
+        auto inserter = std::back_inserter(_out);
+        if (summary.length > listedProducts)
+        {
+            std::format_to(inserter, "{}(+{} more)", listedProducts > 0 ? " " : "", summary.length - listedProducts);
+        }
+        _out += '\n';
+        _out.append(offset, '\t');
+        std::format_to(inserter, "Queue length: {}", summary.length);
+        if (summary.length > 0)
+        {
+            std::format_to(inserter, ", oldest: #{}, newest: #{}\n", summary.oldestProduct, summary.newestProduct);
+            _out.append(offset, '\t');
+            std::format_to(inserter, "Queue age: p50 = {}, p90 = {}, p99 = {}", summary.ageP50, summary.ageP90,
+                           summary.ageP99);
+        }
+    }
+
+    void TextRaportSink::endNode()
+    {
+        _out += "\n\n";
+        _separate = false;
+    }
+
+    void TextRaportSink::beginLatencyRaport()
+    {
+        _out += "========= Latency Raport =========\n";
+    }
+
+    void TextRaportSink::writeLatency(size_t offset, std::string_view name, const LatencyStatistic &statistic)
+    {
+        _out += '\n';
+        _out.append(offset, '\t');
+        std::format_to(std::back_inserter(_out), "{}: count {}, mean {:.2f}, max {}", name, statistic.count,
+                       statistic.getMean(), statistic.max);
+    }
+
+    std::string_view TextRaportSink::getNodeName(NodeType type)
+    {
+        switch (type)
+        {
+        case NodeType::RAMP:
+            return "LOADING_RAMP";
+        case NodeType::WORKER:
+            return "WORKER";
+        case NodeType::STORE:
+            return "STOREHOUSE";
+        default:
+            return "";
+        }
+    }
+
+    std::string IStructureRaportable::getStructureRaport(size_t offset) const
+    {
+        std::string out;
+        TextRaportSink sink{out};
+        writeStructureRaport(sink, offset);
+        return out;
+    }
+
+    std::string IStateRaportable::getStateRaport(size_t offset) const
+    {
+        std::string out;
+        TextRaportSink sink{out};
+        writeStateRaport(sink, offset);
+        return out;
+    }
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "ThreadPool.hpp"
+
+namespace sd
+{
+    ThreadPool::ThreadPool(size_t threadsCount)
+        : _errors(std::max<size_t>(threadsCount, 1)),
+          _startBarrier(static_cast<std::ptrdiff_t>(_errors.size())),
+          _endBarrier(static_cast<std::ptrdiff_t>(_errors.size()))
+    {
+        _threads.reserve(_errors.size() - 1);
+        for (size_t thread = 1; thread < _errors.size(); ++thread)
+        {
+            _threads.emplace_back(&ThreadPool::work, this, thread);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        _stopping = true;
+        _startBarrier.arrive_and_wait();
+        for (auto &thread : _threads)
+        {
+            thread.join();
+        }
+    }
+
+    size_t ThreadPool::getThreadsCount() const
+    {
+        return _errors.size();
+    }
+
+    void ThreadPool::run(std::function<void(size_t)> task)
+    {
+        _task = std::move(task);
+        _startBarrier.arrive_and_wait();
+        execute(0);
+        _endBarrier.arrive_and_wait();
+        std::exception_ptr error;
+        for (auto &threadError : _errors)
+        {
+            if (!error)
+            {
+                error = threadError;
+            }
+            threadError = nullptr;
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    size_t ThreadPool::getDefaultThreadsCount()
+    {
+        return std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    void ThreadPool::work(size_t thread)
+    {
+        while (true)
+        {
+            _startBarrier.arrive_and_wait();
+            if (_stopping)
+            {
+                return;
+            }
+            execute(thread);
+            _endBarrier.arrive_and_wait();
+        }
+    }
+
+    void ThreadPool::execute(size_t thread)
+    {
+        try
+        {
+            _task(thread);
+        }
+        catch (...)
+        {
+            _errors[thread] = std::current_exception();
+        }
+    }
+} // namespace sd
\ No newline at end of file
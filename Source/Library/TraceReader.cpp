@@ -0,0 +1,97 @@
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include "TraceReader.hpp"
+
+namespace sd
+{
+    namespace
+    {
+        std::vector<uint8_t> readFile(const std::filesystem::path &path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                throw std::runtime_error(std::format("Could not open trace file: {}", path.string()));
+            }
+            return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        }
+    } // namespace
+
+    TraceReader::TraceReader(const std::filesystem::path &path) : TraceReader(readFile(path))
+    {
+    }
+
+    TraceReader::TraceReader(std::vector<uint8_t> data) : _data(std::move(data))
+    {
+        readHeader();
+    }
+
+    size_t TraceReader::getStartTime() const
+    {
+        return _startTime;
+    }
+
+    std::optional<EventTrace::Event> TraceReader::next()
+    {
+        while (_offset < _data.size())
+        {
+            auto type = static_cast<EventTrace::EventType>(_data[_offset++]);
+            if (type == EventTrace::TICK)
+            {
+                _time += readVarint();
+                continue;
+            }
+            if (type > EventTrace::STORE_ARRIVAL)
+            {
+                throw std::runtime_error(std::format("Trace contains unknown event type {}", int{type}));
+            }
+            auto product = readVarint();
+            auto id = readVarint();
+            EventTrace::Event event{_time, type, product, id, 0};
+            if (EventTrace::hasQueueSize(type))
+            {
+                event.queueSize = readVarint();
+            }
+            return event;
+        }
+        return std::nullopt;
+    }
+
+    std::vector<EventTrace::Event> TraceReader::readAll()
+    {
+        std::vector<EventTrace::Event> events;
+        while (auto event = next())
+        {
+            events.push_back(*event);
+        }
+        return events;
+    }
+
+    uint64_t TraceReader::readVarint()
+    {
+        uint64_t value;
+        auto begin = _data.data() + _offset;
+        _offset += EventTrace::readVarint(begin, _data.data() + _data.size(), value) - begin;
+        return value;
+    }
+
+    void TraceReader::readHeader()
+    {
+        auto &magic = EventTrace::Magic;
+        if (_data.size() <= magic.size() || !std::equal(magic.begin(), magic.end(), _data.begin()))
+        {
+            throw std::runtime_error("Trace has invalid header");
+        }
+        _offset = magic.size();
+        if (auto version = _data[_offset++]; version != EventTrace::Version)
+        {
+            throw std::runtime_error(std::format("Unsupported trace version {}", int{version}));
+        }
+        _startTime = readVarint();
+        _time = _startTime;
+    }
+} // namespace sd
\ No newline at end of file
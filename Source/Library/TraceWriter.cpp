@@ -0,0 +1,139 @@
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "TraceWriter.hpp"
+
+namespace sd
+{
+    TraceWriter::TraceWriter(const std::filesystem::path &path) : _path(path)
+    {
+#ifdef _WIN32
+        _file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+        {
+            _file = nullptr;
+        }
+        if (!_file)
+#else
+        _file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (_file < 0)
+#endif
+        {
+            throw std::runtime_error(std::format("Could not open trace file: {}", path.string()));
+        }
+        map(MappingChunk);
+    }
+
+    TraceWriter::~TraceWriter()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    void TraceWriter::append(const uint8_t *data, size_t size)
+    {
+        std::memcpy(prepare(size), data, size);
+        _size += size;
+    }
+
+    size_t TraceWriter::getSize() const
+    {
+        return _size;
+    }
+
+    void TraceWriter::close()
+    {
+#ifdef _WIN32
+        if (!_file)
+        {
+            return;
+        }
+        unmap();
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(_size);
+        auto truncated = SetFilePointerEx(_file, size, nullptr, FILE_BEGIN) && SetEndOfFile(_file);
+        CloseHandle(_file);
+        _file = nullptr;
+#else
+        if (_file < 0)
+        {
+            return;
+        }
+        unmap();
+        auto truncated = ::ftruncate(_file, static_cast<off_t>(_size)) == 0;
+        ::close(_file);
+        _file = -1;
+#endif
+        if (!truncated)
+        {
+            throw std::runtime_error(std::format("Could not finalize trace file: {}", _path.string()));
+        }
+    }
+
+    void TraceWriter::reserve(size_t size)
+    {
+        auto capacity = std::max(_capacity * 2, (size + MappingChunk - 1) / MappingChunk * MappingChunk);
+        unmap();
+        map(capacity);
+    }
+
+    void TraceWriter::map(size_t capacity)
+    {
+#ifdef _WIN32
+        LARGE_INTEGER size;
+        size.QuadPart = static_cast<LONGLONG>(capacity);
+        _mapping = CreateFileMappingW(_file, nullptr, PAGE_READWRITE, size.HighPart, size.LowPart, nullptr);
+        _data = _mapping ? static_cast<uint8_t *>(MapViewOfFile(_mapping, FILE_MAP_WRITE, 0, 0, capacity)) : nullptr;
+#else
+        if (::ftruncate(_file, static_cast<off_t>(capacity)) == 0)
+        {
+            auto data = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, _file, 0);
+            _data = data == MAP_FAILED ? nullptr : static_cast<uint8_t *>(data);
+        }
+#endif
+        if (!_data)
+        {
+            throw std::runtime_error(std::format("Could not map {} bytes of trace file: {}", capacity, _path.string()));
+        }
+        _capacity = capacity;
+    }
+
+    void TraceWriter::unmap()
+    {
+#ifdef _WIN32
+        if (_data)
+        {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping)
+        {
+            CloseHandle(_mapping);
+            _mapping = nullptr;
+        }
+#else
+        if (_data)
+        {
+            ::munmap(_data, _capacity);
+        }
+#endif
+        _data = nullptr;
+        _capacity = 0;
+    }
+} // namespace sd
\ No newline at end of file
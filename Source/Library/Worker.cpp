@@ -1,47 +1,54 @@
 #include <format>
 #include <sstream>
 
+#include "EventTrace.hpp"
+#include "LatencyTracker.hpp"
 #include "Worker.hpp"
 
 namespace sd
 {
-    Worker::Worker(size_t id, WorkerType type, size_t processingTime)
-        : SourceNode(id), Processable(processingTime), DestinationNode(id), _type(type), Node(id)
+    Worker::Worker(size_t id, WorkerType type, size_t processingTime, size_t capacity)
+        : SourceNode(id), Processable(processingTime), DestinationNode(id, capacity), _type(type), Node(id)
     {
     }
 
-    Worker::Worker(const WorkerData &data) : Worker(data.id, data.type, data.processingTime)
+    Worker::Worker(const WorkerData &data) : Worker(data.id, data.type, data.processingTime, data.capacity)
     {
     }
 
-    bool Worker::isProcessingProduct() const
+    const Product *Worker::getCurrentProduct() const
     {
-        return bool{_currentProduct};
+        return _currentProduct.get();
     }
 
-    std::string Worker::getStructureRaport(size_t offset) const
+    void Worker::restoreService(Product::Ptr &&product, size_t processedTime)
     {
-        std::stringstream out;
-        out << getOffset(offset++) << toString() << std::endl;
-        out << getOffset(offset) << "Processing time: " << getTotalProcesingTime() << std::endl;
-        out << getOffset(offset) << "Queue type: " << sd::toString(getWorkerType()) << std::endl;
-        out << SourceNode::getStructureRaport(offset);
-        return out.str();
+        _currentProduct = std::move(product);
+        restore(processedTime, !_currentProduct);
     }
 
-    std::string Worker::getStateRaport(size_t offset) const
+    void Worker::writeStructureRaport(IRaportSink &sink, size_t offset) const
     {
-        std::stringstream out;
-        out << getOffset(offset) << toString() << std::endl;
-        out << getOffset(++offset) << "Queue: " << getCurrentWorkRaport() << DestinationNode::getStateRaport(offset);
-        return out.str();
-    };
+        sink.beginNode(offset++, getNodeType(), getId());
+        sink.writeProperty(offset, "Processing time", getTotalProcesingTime());
+        sink.writeProperty(offset, "Queue type", sd::toString(getWorkerType()));
+        if (getCapacity() > 0)
+        {
+            sink.writeProperty(offset, "Queue capacity", getCapacity());
+        }
+        SourceNode::writeStructureRaport(sink, offset);
+    }
 
-    std::string Worker::getCurrentWorkRaport() const
+    void Worker::writeStateRaport(IRaportSink &sink, size_t offset) const
     {
-        return _currentProduct ? std::format("{} (pt = {}), ", _currentProduct->toString(), getCurrentProcesingTime())
-                               : "";
-    };
+        sink.beginNode(offset, getNodeType(), getId());
+        sink.beginQueue(++offset);
+        if (_currentProduct)
+        {
+            sink.writeCurrentProduct(_currentProduct->getId(), getCurrentProcesingTime());
+        }
+        DestinationNode::writeStateRaport(sink, offset);
+    }
 
     std::string Worker::toString() const
     {
@@ -55,12 +62,20 @@ namespace sd
 
     void Worker::process(const size_t currentTime)
     {
+        if (isBlocked())
+        {
+            return;
+        }
         if (!isProcessingProduct())
         {
             if (areProductsAvailable())
             {
-                _currentProduct = std::move(getStoredProduct(_type == WorkerType::FIFO));
-                reset();
+                startService();
+                auto &state = getNodeState();
+                if (auto tracker = state.latencyTracker)
+                {
+                    tracker->recordServiceStart(*state.latency, *_currentProduct, currentTime);
+                }
             }
         }
         if (isProcessingProduct())
@@ -69,13 +84,50 @@ namespace sd
         }
     }
 
+    void Worker::skip(const size_t ticks)
+    {
+        if (isProcessingProduct() && !isBlocked())
+        {
+            Processable::skip(ticks);
+        }
+    }
+
+    void Worker::saveCheckpoint(BinaryWriter &writer, bool latency) const
+    {
+        SourceNode::saveCheckpoint(writer);
+        DestinationNode::saveCheckpoint(writer, latency);
+        Processable::saveCheckpoint(writer);
+        Product::saveCheckpoint(writer, _currentProduct);
+    }
+
+    void Worker::loadCheckpoint(BinaryReader &reader)
+    {
+        SourceNode::loadCheckpoint(reader);
+        DestinationNode::loadCheckpoint(reader);
+        Processable::loadCheckpoint(reader);
+        _currentProduct = Product::loadCheckpoint(reader, getProductPool());
+    }
+
     void Worker::triggerOperation()
     {
+        auto &state = getNodeState();
+        if (auto trace = state.trace)
+        {
+            trace->record(EventTrace::SERVICE_END, _currentProduct->getId(), getId());
+        }
+        auto tracker = state.latencyTracker;
+        if (tracker)
+        {
+            tracker->recordServiceEnd(*state.latency, *_currentProduct, getCurrentProcesingTime());
+        }
         setProduct(std::move(_currentProduct));
         if (areProductsAvailable())
         {
-            _currentProduct = std::move(getStoredProduct(_type == WorkerType::FIFO));
-            reset();
+            startService();
+            if (tracker)
+            {
+                tracker->recordServiceStart(*state.latency, *_currentProduct, tracker->getTime() + 1);
+            }
         }
         else
         {
@@ -83,6 +135,16 @@ namespace sd
         }
     }
 
+    void Worker::startService()
+    {
+        _currentProduct = getStoredProduct(_type == WorkerType::FIFO);
+        reset();
+        if (auto trace = getNodeState().trace)
+        {
+            trace->record(EventTrace::SERVICE_START, _currentProduct->getId(), getId());
+        }
+    }
+
     WorkerType Worker::getWorkerType() const
     {
         return _type;
@@ -90,6 +152,6 @@ namespace sd
 
     const WorkerData Worker::getWorkerData() const
     {
-        return {getId(), getTotalProcesingTime(), getWorkerType()};
+        return {getId(), getTotalProcesingTime(), getWorkerType(), getCapacity()};
     }
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace sd
+{
+    class AliasTable
+    {
+      private:
+        std::vector<double> _probabilities;
+        std::vector<size_t> _aliases;
+
+      public:
+        AliasTable() = default;
+
+        // constexpr, so StaticFactory builds its link tables at compile time with the same construction
+        constexpr AliasTable(const std::vector<double> &weights)
+            : _probabilities(weights.size(), 1.0), _aliases(weights.size())
+        {
+            const auto count = weights.size();
+            const auto total = std::accumulate(weights.begin(), weights.end(), 0.0);
+            if (count > 0 && !(total > 0))
+            {
+                throw std::runtime_error("Alias table requires positive total weight");
+            }
+            std::iota(_aliases.begin(), _aliases.end(), size_t{0});
+            if (count < 2)
+            {
+                return;
+            }
+
+            std::vector<double> scaled(count);
+            std::vector<size_t> small;
+            std::vector<size_t> large;
+            for (size_t index = 0; index < count; ++index)
+            {
+                scaled[index] = weights[index] * static_cast<double>(count) / total;
+                (scaled[index] < 1.0 ? small : large).push_back(index);
+            }
+            while (!small.empty() && !large.empty())
+            {
+                auto less = small.back();
+                small.pop_back();
+                auto more = large.back();
+                _probabilities[less] = scaled[less];
+                _aliases[less] = more;
+                scaled[more] -= 1.0 - scaled[less];
+                if (scaled[more] < 1.0)
+                {
+                    large.pop_back();
+                    small.push_back(more);
+                }
+            }
+        }
+
+        size_t sample(double propability) const;
+
+        size_t size() const;
+        bool empty() const;
+
+        constexpr const std::vector<double> &getProbabilities() const
+        {
+            return _probabilities;
+        }
+        constexpr const std::vector<size_t> &getAliases() const
+        {
+            return _aliases;
+        }
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RaportSnapshot.hpp"
+
+namespace sd
+{
+    class AsyncRaportWriter
+    {
+      private:
+        std::ostream *_out = nullptr;
+        IRaportSink *_sink = nullptr;
+        const size_t _capacity;
+
+        std::mutex _mutex;
+        std::condition_variable _changed;
+        std::deque<RaportSnapshot> _pending;
+        std::vector<RaportSnapshot> _free;
+        size_t _inFlight = 0;
+        bool _stopping = false;
+        std::exception_ptr _error;
+
+        std::thread _thread;
+
+      public:
+        AsyncRaportWriter(std::ostream &out, size_t capacity);
+        AsyncRaportWriter(IRaportSink &sink, size_t capacity);
+        AsyncRaportWriter(const AsyncRaportWriter &) = delete;
+        AsyncRaportWriter &operator=(const AsyncRaportWriter &) = delete;
+        ~AsyncRaportWriter();
+
+        RaportSnapshot acquire();
+        void submit(RaportSnapshot &&snapshot);
+
+        void flush();
+
+        size_t getCapacity() const;
+
+      private:
+        void start();
+        void work();
+        void checkError();
+    };
+} // namespace sd
\ No newline at end of file
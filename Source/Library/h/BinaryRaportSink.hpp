@@ -0,0 +1,59 @@
+#pragma once
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+#include "Interfaces.hpp"
+
+namespace sd
+{
+    class BinaryRaportSink final : public IRaportSink
+    {
+      public:
+        enum Record : uint8_t
+        {
+            SECTION,
+            NODE,
+            NUMBER_PROPERTY,
+            TEXT_PROPERTY,
+            LINKS,
+            LINK,
+            QUEUE,
+            CURRENT_PRODUCT,
+            PRODUCT,
+            END_NODE,
+            RAPORT,
+            QUEUE_SUMMARY,
+            LATENCY_RAPORT,
+            LATENCY
+        };
+
+      private:
+        std::vector<uint8_t> &_out;
+
+      public:
+        BinaryRaportSink(std::vector<uint8_t> &out);
+
+        void beginRaport(size_t time, bool delta) final;
+        void beginSection(std::string_view title) final;
+        void beginNode(size_t offset, NodeType type, size_t id) final;
+        void writeProperty(size_t offset, std::string_view name, size_t value) final;
+        void writeProperty(size_t offset, std::string_view name, std::string_view value) final;
+        void beginLinks(size_t offset) final;
+        void writeLink(size_t offset, NodeType type, size_t id, double probability) final;
+        void beginQueue(size_t offset) final;
+        void writeCurrentProduct(uint64_t id, size_t processingTime) final;
+        void writeProduct(uint64_t id) final;
+        void writeQueueSummary(size_t offset, const QueueSummary &summary, size_t listedProducts) final;
+        void endNode() final;
+        void beginLatencyRaport() final;
+        void writeLatency(size_t offset, std::string_view name, const LatencyStatistic &statistic) final;
+
+        static void replay(const std::vector<uint8_t> &data, IRaportSink &sink);
+
+      private:
+        void writeRecord(Record record, std::initializer_list<uint64_t> values);
+        void writeVarint(uint64_t value);
+        void writeText(std::string_view text);
+    };
+} // namespace sd
\ No newline at end of file
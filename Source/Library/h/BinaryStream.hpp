@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace sd
+{
+    // Values are stored in the byte order of the host, so checkpoints, structure and metrics files are only
+    // portable between machines of the same endianness.
+    class BinaryWriter
+    {
+      private:
+        std::ostream &_out;
+
+      public:
+        BinaryWriter(std::ostream &out) : _out(out)
+        {
+        }
+
+        template <class T> void write(const T &value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            _out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        template <class T> void writeVector(const std::vector<T> &values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            write<uint64_t>(values.size());
+            _out.write(reinterpret_cast<const char *>(values.data()), std::streamsize(values.size() * sizeof(T)));
+        }
+
+        void writeString(const std::string &value)
+        {
+            write<uint64_t>(value.size());
+            _out.write(value.data(), std::streamsize(value.size()));
+        }
+    };
+
+    class BinaryReader
+    {
+      private:
+        std::istream &_in;
+        const char *_corruptedMessage;
+
+      public:
+        BinaryReader(std::istream &in, const char *corruptedMessage = "Binary stream is corrupted")
+            : _in(in), _corruptedMessage(corruptedMessage)
+        {
+        }
+
+        template <class T> T read()
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value;
+            readBytes(reinterpret_cast<char *>(&value), sizeof(T));
+            return value;
+        }
+
+        template <class T> std::vector<T> readVector()
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            std::vector<T> values(readCount(sizeof(T)));
+            readBytes(reinterpret_cast<char *>(values.data()), values.size() * sizeof(T));
+            return values;
+        }
+
+        std::string readString()
+        {
+            std::string value(readCount(1), '\0');
+            readBytes(value.data(), value.size());
+            return value;
+        }
+
+      private:
+        size_t readCount(size_t elementSize)
+        {
+            auto count = read<uint64_t>();
+            auto remaining = getRemainingSize();
+            if (remaining && count > *remaining / elementSize)
+            {
+                throw std::runtime_error(_corruptedMessage);
+            }
+            return static_cast<size_t>(count);
+        }
+
+        std::optional<uint64_t> getRemainingSize()
+        {
+            auto position = _in.tellg();
+            if (position == std::streampos(-1) || !_in.seekg(0, std::ios::end))
+            {
+                _in.clear();
+                return std::nullopt;
+            }
+            auto end = _in.tellg();
+            _in.seekg(position);
+            return static_cast<uint64_t>(end - position);
+        }
+
+        void readBytes(char *data, size_t size)
+        {
+            if (!_in.read(data, std::streamsize(size)))
+            {
+                throw std::runtime_error(_corruptedMessage);
+            }
+        }
+    };
+} // namespace sd
\ No newline at end of file
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <variant>
 #include <vector>
 
+#include "RunOptions.hpp"
 
 namespace sd
 {
@@ -15,6 +17,15 @@ namespace sd
 
         std::variant<size_t, std::vector<size_t>> stateRaportTimings = size_t{20};
         std::optional<std::string> raportFile = std::nullopt;
+
+        RunOptions runOptions;
+
+        std::optional<size_t> replicas = std::nullopt;
+        std::optional<uint64_t> seed = std::nullopt;
+
+        std::vector<std::string> sweepParameters;
+
+        bool resume = false;
     };
 
 } // namespace sd
\ No newline at end of file
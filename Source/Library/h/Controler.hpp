@@ -35,7 +35,15 @@ namespace sd
         void buildCommandLineInterface();
 
         void runSimulation(const std::optional<std::string> &raportfilePath, size_t maxIterations,
-                           const Factory::RaportGuard &raportGuard);
+                           const Factory::RaportGuard &raportGuard, const RunOptions &options,
+                           const std::optional<uint64_t> &raportOffset = std::nullopt);
+        void runReplications(const std::optional<std::string> &raportfilePath, size_t maxIterations, size_t replicas,
+                             const RunOptions &options);
+        void runSweep(const std::optional<std::string> &raportfilePath, size_t maxIterations, size_t replicas,
+                      const RunOptions &options);
+
+        void writeRaport(const std::optional<std::string> &raportfilePath, const std::string &raport);
+        uint64_t getSeed() const;
 
         std::ostream &getOut();
         std::ostream &getErr();
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "BinaryStream.hpp"
+#include "RaportSnapshot.hpp"
+
+namespace sd
+{
+    class DeltaRaportTracker
+    {
+      private:
+        static constexpr uint64_t NotReported = static_cast<uint64_t>(-1);
+
+        struct WorkerMark
+        {
+            uint64_t version = NotReported;
+            uint64_t currentProduct = NotReported;
+            size_t processingTime = 0;
+        };
+
+        const size_t _keyframeInterval;
+        size_t _raportsCount = 0;
+        std::vector<WorkerMark> _workers;
+        std::vector<uint64_t> _storeHouses;
+
+      public:
+        DeltaRaportTracker(size_t keyframeInterval);
+
+        bool beginRaport(size_t workersCount, size_t storeHousesCount);
+
+        bool updateWorker(size_t index, uint64_t version, const RaportSnapshot::WorkerState &state);
+        bool updateStoreHouse(size_t index, uint64_t version);
+
+        void saveCheckpoint(BinaryWriter &writer) const;
+        static std::unique_ptr<DeltaRaportTracker> loadCheckpoint(BinaryReader &reader);
+    };
+} // namespace sd
\ No newline at end of file
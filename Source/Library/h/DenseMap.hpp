@@ -0,0 +1,184 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace sd
+{
+    template <class Value> class DenseMap
+    {
+      public:
+        using Entry = std::pair<size_t, Value>;
+        using iterator = typename std::vector<Entry>::iterator;
+        using const_iterator = typename std::vector<Entry>::const_iterator;
+
+      private:
+        static constexpr size_t EmptySlot = std::numeric_limits<size_t>::max();
+        static constexpr size_t MinSlotsCount = 16;
+
+        // kept sorted by key on every modification, so const access never changes the map
+        std::vector<Entry> _entries;
+        std::vector<size_t> _slots = std::vector<size_t>(MinSlotsCount, EmptySlot);
+
+      public:
+        size_t size() const
+        {
+            return _entries.size();
+        }
+
+        bool empty() const
+        {
+            return _entries.empty();
+        }
+
+        void reserve(size_t size)
+        {
+            _entries.reserve(size);
+            if (size * 2 > _slots.size())
+            {
+                rehash(getSlotsCount(size));
+            }
+        }
+
+        iterator begin()
+        {
+            return _entries.begin();
+        }
+
+        iterator end()
+        {
+            return _entries.end();
+        }
+
+        const_iterator begin() const
+        {
+            return _entries.begin();
+        }
+
+        const_iterator end() const
+        {
+            return _entries.end();
+        }
+
+        iterator find(size_t key)
+        {
+            auto index = _slots[findSlot(key)];
+            return index == EmptySlot ? _entries.end() : _entries.begin() + index;
+        }
+
+        const_iterator find(size_t key) const
+        {
+            auto index = _slots[findSlot(key)];
+            return index == EmptySlot ? _entries.end() : _entries.begin() + index;
+        }
+
+        bool contains(size_t key) const
+        {
+            return _slots[findSlot(key)] != EmptySlot;
+        }
+
+        std::pair<iterator, bool> emplace(size_t key, Value value)
+        {
+            if ((_entries.size() + 1) * 2 > _slots.size())
+            {
+                rehash(_slots.size() * 2);
+            }
+            auto slot = findSlot(key);
+            if (_slots[slot] != EmptySlot)
+            {
+                return {_entries.begin() + _slots[slot], false};
+            }
+            if (_entries.empty() || _entries.back().first < key)
+            {
+                _slots[slot] = _entries.size();
+                _entries.emplace_back(key, std::move(value));
+                return {std::prev(_entries.end()), true};
+            }
+            auto position = std::lower_bound(_entries.begin(), _entries.end(), key,
+                                             [](const Entry &entry, size_t key) { return entry.first < key; });
+            position = _entries.emplace(position, key, std::move(value));
+            rehash(_slots.size());
+            return {position, true};
+        }
+
+        void erase(iterator position)
+        {
+            if (std::next(position) == _entries.end())
+            {
+                eraseSlot(findSlot(position->first));
+                _entries.pop_back();
+                return;
+            }
+            _entries.erase(position);
+            rehash(_slots.size());
+        }
+
+        template <class Predicate> size_t erase_if(Predicate predicate)
+        {
+            auto removed = std::erase_if(_entries, predicate);
+            if (removed > 0)
+            {
+                rehash(_slots.size());
+            }
+            return removed;
+        }
+
+      private:
+        static size_t getSlotsCount(size_t size)
+        {
+            auto slotsCount = MinSlotsCount;
+            while (slotsCount < size * 2)
+            {
+                slotsCount *= 2;
+            }
+            return slotsCount;
+        }
+
+        static size_t hash(size_t key)
+        {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdULL;
+            return key ^ (key >> 33);
+        }
+
+        size_t findSlot(size_t key) const
+        {
+            const auto mask = _slots.size() - 1;
+            for (auto slot = hash(key) & mask;; slot = (slot + 1) & mask)
+            {
+                auto index = _slots[slot];
+                if (index == EmptySlot || _entries[index].first == key)
+                {
+                    return slot;
+                }
+            }
+        }
+
+        void eraseSlot(size_t slot)
+        {
+            const auto mask = _slots.size() - 1;
+            for (auto next = (slot + 1) & mask; _slots[next] != EmptySlot; next = (next + 1) & mask)
+            {
+                auto home = hash(_entries[_slots[next]].first) & mask;
+                if (((next - home) & mask) >= ((next - slot) & mask))
+                {
+                    _slots[slot] = _slots[next];
+                    slot = next;
+                }
+            }
+            _slots[slot] = EmptySlot;
+        }
+
+        void rehash(size_t slotsCount)
+        {
+            _slots.assign(slotsCount, EmptySlot);
+            for (size_t index = 0; index < _entries.size(); ++index)
+            {
+                _slots[findSlot(_entries[index].first)] = index;
+            }
+        }
+    };
+} // namespace sd
\ No newline at end of file
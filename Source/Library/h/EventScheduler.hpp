@@ -0,0 +1,69 @@
+#pragma once
+
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include "EventTrace.hpp"
+#include "LatencyTracker.hpp"
+#include "LoadingRamp.hpp"
+#include "Worker.hpp"
+
+namespace sd
+{
+    class EventScheduler
+    {
+      private:
+        enum EventType
+        {
+            RAMP_DELIVERY,
+            WORKER_PASS,
+            WORKER_PROCESS
+        };
+
+        struct Event
+        {
+            size_t time;
+            EventType type;
+            size_t index;
+
+            auto operator<=>(const Event &other) const = default;
+        };
+
+        static constexpr size_t NotScheduled = static_cast<size_t>(-1);
+
+        std::vector<LoadingRamp *> _ramps;
+        std::vector<Worker *> _workers;
+        EventTrace *_trace;
+        LatencyTracker *_latency;
+        std::unordered_map<const DestinationNode *, size_t> _workerIndexes;
+
+        std::vector<size_t> _rampSyncTimes;
+        std::vector<size_t> _workerSyncTimes;
+        std::vector<size_t> _workerProcessTimes;
+        std::vector<std::vector<Event>> _waitingSources;
+
+        std::priority_queue<Event, std::vector<Event>, std::greater<Event>> _calendar;
+
+      public:
+        EventScheduler(std::vector<LoadingRamp *> ramps, std::vector<Worker *> workers, size_t startTime = 0,
+                       EventTrace *trace = nullptr, LatencyTracker *latency = nullptr);
+
+        void runUntil(size_t endTime);
+
+      private:
+        void deliver(size_t index, size_t time);
+        void passFromWorker(size_t index, size_t time);
+        void processWorker(size_t index, size_t time);
+
+        void notifyArrival(const DestinationNode *destination, size_t time);
+        void waitForSpace(const SourceNode &source, EventType type, size_t index);
+        void notifySpace(size_t index, size_t time);
+        void resumeWorker(size_t index, size_t time);
+
+        void scheduleRamp(size_t index);
+        void scheduleWorker(size_t index);
+
+        void synchronize(size_t endTime);
+    };
+} // namespace sd
\ No newline at end of file
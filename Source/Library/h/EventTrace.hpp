@@ -0,0 +1,107 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "TraceWriter.hpp"
+
+namespace sd
+{
+    // Records are encoded inline into a fixed-size block that is appended to the writer whole when it fills up,
+    // so the tick path does not touch the file mapping per event. The last block is written by flush, which must
+    // run before the writer is closed. Traces without writer keep growing their block.
+    class EventTrace
+    {
+      public:
+        enum EventType : uint8_t
+        {
+            TICK,
+            PRODUCT_CREATED,
+            LINK_HOP,
+            ENQUEUE,
+            SERVICE_START,
+            SERVICE_END,
+            STORE_ARRIVAL
+        };
+
+        struct Event
+        {
+            size_t time;
+            EventType type;
+            uint64_t product;
+            uint64_t id;
+            uint64_t queueSize = 0;
+
+            auto operator<=>(const Event &other) const = default;
+        };
+
+        static constexpr std::array<uint8_t, 4> Magic = {'S', 'D', 'T', 'R'};
+        static constexpr uint8_t Version = 1;
+        static constexpr size_t MaxVarintSize = 10;
+        static constexpr size_t BlockSize = size_t{64} << 10;
+
+      private:
+        TraceWriter *_writer = nullptr;
+        std::vector<uint8_t> _buffer;
+        size_t _size = 0;
+        size_t _time = 0;
+
+      public:
+        EventTrace() = default;
+        EventTrace(TraceWriter &writer, size_t startTime = 0);
+
+        void setTime(size_t time);
+        size_t getTime() const;
+
+        void record(EventType type, uint64_t product, uint64_t id, uint64_t queueSize = 0)
+        {
+            auto out = prepare(1 + 3 * MaxVarintSize);
+            *out++ = type;
+            out = writeVarint(out, product);
+            out = writeVarint(out, id);
+            if (hasQueueSize(type))
+            {
+                out = writeVarint(out, queueSize);
+            }
+            commit(out);
+        }
+
+        void append(EventTrace &other);
+        void flush();
+
+        static bool hasQueueSize(EventType type)
+        {
+            return type == ENQUEUE || type == STORE_ARRIVAL;
+        }
+
+        static uint8_t *writeVarint(uint8_t *out, uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                *out++ = static_cast<uint8_t>(value | 0x80);
+                value >>= 7;
+            }
+            *out++ = static_cast<uint8_t>(value);
+            return out;
+        }
+
+        static const uint8_t *readVarint(const uint8_t *in, const uint8_t *end, uint64_t &value);
+
+      private:
+        uint8_t *prepare(size_t size)
+        {
+            if (_size + size > _buffer.size())
+            {
+                reserve(size);
+            }
+            return _buffer.data() + _size;
+        }
+
+        void commit(const uint8_t *end)
+        {
+            _size = end - _buffer.data();
+        }
+
+        void reserve(size_t size);
+    };
+} // namespace sd
\ No newline at end of file
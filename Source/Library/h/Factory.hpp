@@ -1,20 +1,40 @@
 #pragma once
+#include <cstdint>
 #include <filesystem>
 #include <iostream>
-#include <map>
+#include <optional>
 #include <variant>
 
 
+#include "DenseMap.hpp"
+#include "EventTrace.hpp"
+#include "FactoryStructure.hpp"
 #include "Link.hpp"
+#include "LinkTable.hpp"
 #include "LoadingRamp.hpp"
+#include "ProductPool.hpp"
+#include "RaportSnapshot.hpp"
+#include "RunOptions.hpp"
+#include "SimulationContext.hpp"
 #include "StoreHouse.hpp"
 #include "Worker.hpp"
 
 
 namespace sd
 {
+    class AsyncRaportWriter;
+    class DeltaRaportTracker;
+    class FactoryEdit;
+    class LatencyTracker;
+    class MetricsRecorder;
+
     class Factory
     {
+        friend class FactoryEdit;
+        friend class FlatFactory;
+        friend class ReplicationRunner;
+        friend class StructureParser;
+
       public:
         class RaportGuard
         {
@@ -31,26 +51,65 @@ namespace sd
             RaportGuard(const std::variant<size_t, std::vector<size_t>> &var);
 
             bool isRaportTime(size_t currentIteration) const;
+
+            std::optional<size_t> getNextRaportTime(size_t currentIteration) const;
+
+            void seek(size_t currentIteration) const;
+        };
+
+        struct CheckpointInfo
+        {
+            size_t time;
+            std::optional<uint64_t> raportOffset;
         };
 
       private:
-        std::map<size_t, LoadingRamp::Ptr> _loadingRamps;
-        std::map<size_t, Worker::Ptr> _workers;
-        std::map<size_t, StoreHouse::Ptr> _storeHouses;
-        std::map<size_t, Link::WeakPtr> _links;
+        ProductPool _productPool;
+
+        DenseMap<LoadingRamp::Ptr> _loadingRamps;
+        DenseMap<Worker::Ptr> _workers;
+        DenseMap<StoreHouse::Ptr> _storeHouses;
+        LinkTable _links;
+
+        SimulationContext::Ptr _context;
+
+        struct CheckpointJournal;
+        std::unique_ptr<CheckpointJournal> _checkpointJournal;
+        // size of the journal covered by the loaded checkpoint, the rest is dropped when the resumed run appends
+        std::optional<uint64_t> _loadedJournalSize;
+
+        EventTrace *_trace = nullptr;
+        std::unique_ptr<AsyncRaportWriter> _raportWriter;
+        std::unique_ptr<DeltaRaportTracker> _deltaTracker;
+        std::optional<size_t> _summaryProductsLimit;
+        IRaportSink *_raportSink = nullptr;
+        std::unique_ptr<MetricsRecorder> _metrics;
+        std::unique_ptr<LatencyTracker> _latency;
 
       public:
         using Ptr = std::unique_ptr<Factory>;
 
-        void run(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard);
+        Factory();
+        Factory(const FactoryStructure &structure);
+        ~Factory();
+
+        void run(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                 const RunOptions &options = {});
 
-        std::string generateStateRaport();
-        std::string generateStructureRaport();
+        std::string generateStateRaport() const;
+        void writeStateRaport(IRaportSink &sink) const;
+        void captureStateSnapshot(RaportSnapshot &snapshot, size_t time, DeltaRaportTracker *tracker = nullptr,
+                                  std::optional<size_t> summaryProductsLimit = std::nullopt) const;
+        std::string generateStructureRaport() const;
+        void writeStructureRaport(IRaportSink &sink) const;
 
         void addWorker(const WorkerData &data);
         void addLoadingRamp(const LoadingRampData &data);
         void addStorehouse(const StoreHouseData &data);
         void addLink(const LinkData &data);
+        void addStructure(const FactoryStructure &structure);
+
+        FactoryEdit edit();
 
         void removeWorker(size_t id);
         void removeLoadingRamp(size_t id);
@@ -62,10 +121,56 @@ namespace sd
         const std::vector<StoreHouseData> getStorehousesData() const;
         const std::vector<LinkData> getLinksData() const;
 
+        FactoryStructure getStructure() const;
+        Factory::Ptr cloneStructure() const;
+
+        void setContext(SimulationContext::Ptr context);
+        const SimulationContext::Ptr &getContext() const;
+
         bool initialized() const;
         void validate() const;
 
+        const LatencyTracker *getLatencyTracker() const;
+
+        void saveCheckpoint(std::ostream &out, const CheckpointInfo &info) const;
+        CheckpointInfo loadCheckpoint(std::istream &in);
+        CheckpointInfo loadCheckpoint(const std::filesystem::path &checkpointPath);
+
       private:
-        size_t removeExpiredLinks();
+        Link &createLink(const LinkData &data);
+        void eraseLinks(const std::vector<Link *> &links);
+        void normalizeSources();
+
+        void runTicks(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                      const RunOptions &options);
+        void runEvents(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                       const RunOptions &options);
+        void runParallel(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                         const RunOptions &options);
+        void runFlat(size_t maxIterations, std::ostream &raportOutStream, const RaportGuard &raportGuard,
+                     const RunOptions &options);
+
+        std::vector<LoadingRamp *> getLoadingRampsInOrder() const;
+        std::vector<Worker *> getWorkersInOrder() const;
+        std::vector<StoreHouse *> getStoreHousesInOrder() const;
+
+        IRandomDevice &getRandomDevice() const;
+
+        void setTrace(EventTrace *trace);
+        void setLatencyTracker(LatencyTracker *tracker);
+
+        void writeStateRaport(std::ostream &raportOutStream, size_t time);
+        void recordMetrics(size_t time);
+
+        bool isCheckpointTime(const RunOptions &options, size_t time) const;
+        std::optional<size_t> getNextCheckpointTime(const RunOptions &options, size_t time) const;
+        void openCheckpointJournal(const RunOptions &options);
+        void writeCheckpoint(const RunOptions &options, size_t time, std::ostream &raportOutStream);
+        void writeCheckpointState(BinaryWriter &writer, const CheckpointInfo &info,
+                                  std::optional<uint64_t> journalSize) const;
+        std::optional<uint64_t> readCheckpointState(BinaryReader &reader, CheckpointInfo &info);
+
+        size_t getProductIdSeed() const;
+        void setProductIdSeed(size_t productIdSeed);
     };
 } // namespace sd
\ No newline at end of file
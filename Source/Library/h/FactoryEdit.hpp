@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Factory.hpp"
+
+namespace sd
+{
+    // Batches structure changes and applies them on commit as if they were called on the factory in order.
+    // Nothing is changed when commit throws.
+    class FactoryEdit
+    {
+      private:
+        template <class Data> using Additions = std::vector<std::pair<size_t, Data>>;
+        using Removals = std::unordered_map<size_t, std::vector<size_t>>;
+
+        Factory &_factory;
+        size_t _sequence = 0;
+        bool _committed = false;
+
+        Additions<LoadingRampData> _addedLoadingRamps;
+        Additions<WorkerData> _addedWorkers;
+        Additions<StoreHouseData> _addedStoreHouses;
+        Additions<LinkData> _addedLinks;
+
+        Removals _removedLoadingRamps;
+        Removals _removedWorkers;
+        Removals _removedStoreHouses;
+        Removals _removedLinks;
+
+      public:
+        FactoryEdit(Factory &factory);
+
+        void addWorker(const WorkerData &data);
+        void addLoadingRamp(const LoadingRampData &data);
+        void addStorehouse(const StoreHouseData &data);
+        void addLink(const LinkData &data);
+
+        void removeWorker(size_t id);
+        void removeLoadingRamp(size_t id);
+        void removeStorehouse(size_t id);
+        void removeLink(size_t id);
+
+        void commit();
+
+      private:
+        struct Plan;
+
+        void checkNotCommitted() const;
+
+        Plan createPlan() const;
+        void checkPlan(const Plan &plan) const;
+        void applyPlan(const Plan &plan);
+
+        const Removals &getRemovals(NodeType type) const;
+        bool isRemoved(const Removals &removals, size_t id, size_t sequence) const;
+        bool isRemovedBetween(const Removals &removals, size_t id, size_t from, size_t to) const;
+        bool isRemovedNode(NodeType type, size_t id) const;
+    };
+} // namespace sd
\ No newline at end of file
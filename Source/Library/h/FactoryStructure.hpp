@@ -0,0 +1,19 @@
+#pragma once
+
+#include <vector>
+
+#include "Link.hpp"
+#include "LoadingRamp.hpp"
+#include "StoreHouse.hpp"
+#include "Worker.hpp"
+
+namespace sd
+{
+    struct FactoryStructure
+    {
+        std::vector<LoadingRampData> loadingRamps;
+        std::vector<WorkerData> workers;
+        std::vector<StoreHouseData> storeHouses;
+        std::vector<LinkData> links;
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Factory.hpp"
+#include "Interfaces.hpp"
+
+namespace sd
+{
+    class FlatFactory
+    {
+      private:
+        static constexpr size_t NoProduct = static_cast<size_t>(-1);
+
+        struct FlatProduct
+        {
+            size_t id = NoProduct;
+            size_t creationTime = 0;
+        };
+
+        std::vector<size_t> _rampIds;
+        std::vector<size_t> _rampDeliveryIntervals;
+        std::vector<size_t> _rampCounters;
+
+        std::vector<size_t> _workerIds;
+        std::vector<size_t> _workerProcessingTimes;
+        std::vector<size_t> _workerCounters;
+        std::vector<unsigned char> _workerFifo;
+        std::vector<FlatProduct> _workerCurrentProducts;
+        std::vector<FlatProduct> _workerReadyProducts;
+
+        std::vector<size_t> _storeIds;
+
+        // destinations are indexed workers first, then storehouses
+        std::vector<std::vector<FlatProduct>> _queueBuffers;
+        std::vector<size_t> _queueHeads;
+        std::vector<size_t> _queueSizes;
+
+        // sources are indexed ramps first, then workers
+        std::vector<size_t> _linkOffsets;
+        std::vector<size_t> _linkDestinations;
+        std::vector<double> _linkAliasProbabilities;
+        std::vector<size_t> _linkAliases;
+
+        size_t _productIdSeed = 0;
+        SimulationContext *_context = nullptr;
+
+      public:
+        FlatFactory(const Factory &factory);
+
+        void run(size_t maxIterations, std::ostream &raportOutStream, const Factory::RaportGuard &raportGuard,
+                 IRandomDevice &randomDevice);
+
+        std::string generateStateRaport() const;
+
+        void writeState(Factory &factory) const;
+
+      private:
+        void tick(size_t time, IRandomDevice &randomDevice);
+
+        void passProduct(size_t source, FlatProduct product, IRandomDevice &randomDevice);
+        size_t getRandomDestination(size_t source, double probability) const;
+
+        void pushProduct(size_t destination, FlatProduct product);
+        FlatProduct popProduct(size_t destination, bool first);
+
+        void appendQueue(std::string &out, size_t destination) const;
+        void writeQueue(DestinationNode &node, size_t destination) const;
+        static Product::Ptr createProduct(const Node &node, const FlatProduct &product);
+    };
+} // namespace sd
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 
 #include "Utils.hpp"
@@ -9,11 +12,23 @@
 namespace sd
 {
     class Product;
+    struct QueueSummary;
+    struct LatencyStatistic;
 
     struct IRandomDevice
     {
         virtual double next() = 0;
 
+        virtual std::string saveState() const
+        {
+            throw std::runtime_error("Random device does not support checkpoints");
+        }
+
+        virtual void loadState(const std::string &)
+        {
+            throw std::runtime_error("Random device does not support checkpoints");
+        }
+
         virtual ~IRandomDevice()
         {
         }
@@ -37,21 +52,33 @@ namespace sd
         }
     };
 
-    struct IProcessable
+    struct IRaportSink
     {
-        virtual void process(const size_t currentTime) = 0;
-
-        virtual ~IProcessable()
+        virtual void beginRaport(size_t time, bool delta) = 0;
+        virtual void beginSection(std::string_view title) = 0;
+        virtual void beginNode(size_t offset, NodeType type, size_t id) = 0;
+        virtual void writeProperty(size_t offset, std::string_view name, size_t value) = 0;
+        virtual void writeProperty(size_t offset, std::string_view name, std::string_view value) = 0;
+        virtual void beginLinks(size_t offset) = 0;
+        virtual void writeLink(size_t offset, NodeType type, size_t id, double probability) = 0;
+        virtual void beginQueue(size_t offset) = 0;
+        virtual void writeCurrentProduct(uint64_t id, size_t processingTime) = 0;
+        virtual void writeProduct(uint64_t id) = 0;
+        virtual void writeQueueSummary(size_t offset, const QueueSummary &summary, size_t listedProducts) = 0;
+        virtual void endNode() = 0;
+        virtual void beginLatencyRaport() = 0;
+        virtual void writeLatency(size_t offset, std::string_view name, const LatencyStatistic &statistic) = 0;
+
+        virtual ~IRaportSink()
         {
         }
-
-      protected:
-        virtual void triggerOperation() = 0;
     };
 
     struct IStructureRaportable
     {
-        virtual std::string getStructureRaport(size_t offset) const = 0;
+        virtual void writeStructureRaport(IRaportSink &sink, size_t offset) const = 0;
+
+        std::string getStructureRaport(size_t offset) const;
 
         virtual ~IStructureRaportable()
         {
@@ -60,7 +87,9 @@ namespace sd
 
     struct IStateRaportable
     {
-        virtual std::string getStateRaport(size_t offset) const = 0;
+        virtual void writeStateRaport(IRaportSink &sink, size_t offset) const = 0;
+
+        std::string getStateRaport(size_t offset) const;
 
         virtual ~IStateRaportable()
         {
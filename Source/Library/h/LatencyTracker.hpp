@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BinaryStream.hpp"
+#include "Interfaces.hpp"
+
+namespace sd
+{
+    class Product;
+    class Worker;
+    class StoreHouse;
+
+    struct LatencyStatistic
+    {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        void add(uint64_t value);
+        double getMean() const;
+    };
+
+    // Worker: time spent from enqueue to departure, in queue and in service.
+    // Storehouse: end-to-end time from creation, summed waiting (blocking included) and summed service.
+    struct NodeLatency
+    {
+        LatencyStatistic sojourn;
+        LatencyStatistic waiting;
+        LatencyStatistic service;
+    };
+
+    class LatencyTracker
+    {
+      private:
+        using Entries = std::vector<std::pair<size_t, NodeLatency>>;
+
+        size_t _time = 0;
+        Entries _workers;
+        Entries _storeHouses;
+
+      public:
+        LatencyTracker(const std::vector<Worker *> &workers, const std::vector<StoreHouse *> &storeHouses,
+                       size_t startTime = 0);
+
+        void setTime(size_t time);
+        size_t getTime() const;
+
+        NodeLatency &getWorkerLatency(size_t id);
+        NodeLatency &getStoreHouseLatency(size_t id);
+        const NodeLatency &getWorkerLatency(size_t id) const;
+        const NodeLatency &getStoreHouseLatency(size_t id) const;
+
+        void recordHop(NodeLatency *source, NodeLatency *destination, bool toStoreHouse, Product &product);
+        void recordServiceStart(NodeLatency &worker, const Product &product, size_t startTime);
+        void recordServiceEnd(NodeLatency &worker, Product &product, size_t serviceTime);
+
+        void writeRaport(IRaportSink &sink) const;
+        std::string generateRaport() const;
+
+        void saveCheckpoint(BinaryWriter &writer) const;
+        void loadCheckpoint(BinaryReader &reader);
+
+      private:
+        static const NodeLatency &find(const Entries &entries, size_t id, const char *name);
+    };
+} // namespace sd
\ No newline at end of file
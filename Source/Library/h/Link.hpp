@@ -40,9 +40,6 @@ namespace sd
         DestinationNode &_destination;
 
       public:
-        using Ptr = std::shared_ptr<Link>;
-        using WeakPtr = std::weak_ptr<Link>;
-
         Link(size_t id, double probability, SourceNode &source, DestinationNode &destination);
         Link(const LinkData &data, SourceNode &source, DestinationNode &destination);
 
@@ -51,7 +48,7 @@ namespace sd
         SourceNode &getSource();
         DestinationNode &getDestination();
 
-        std::string getStructureRaport(size_t offset) const final;
+        void writeStructureRaport(IRaportSink &sink, size_t offset) const final;
 
         double getBaseProbability() const;
 
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include "DenseMap.hpp"
+#include "Link.hpp"
+
+namespace sd
+{
+    class LinkTable
+    {
+      private:
+        std::deque<std::optional<Link>> _links;
+        std::vector<size_t> _freeIndexes;
+        DenseMap<size_t> _indexes;
+        // kept sorted by id on every modification, links are mostly created in increasing id order
+        std::vector<const Link *> _order;
+
+      public:
+        LinkTable() = default;
+        LinkTable(const LinkTable &) = delete;
+        LinkTable &operator=(const LinkTable &) = delete;
+
+        Link &emplace(const LinkData &data, SourceNode &source, DestinationNode &destination);
+        Link *find(size_t id);
+        void erase(size_t id);
+        void reserve(size_t size);
+
+        size_t size() const;
+        bool empty() const;
+
+        const std::vector<const Link *> &getLinksInOrder() const;
+    };
+} // namespace sd
\ No newline at end of file
@@ -16,8 +16,13 @@ namespace sd
         size_t deliveryInterval;
     };
 
-    class LoadingRamp final : public SourceNode, public Processable
+    class LoadingRamp final : public SourceNode, public Processable<LoadingRamp>
     {
+        friend class Processable<LoadingRamp>;
+
+      private:
+        size_t _time = 0;
+
       public:
         using Ptr = std::unique_ptr<LoadingRamp>;
 
@@ -27,16 +32,26 @@ namespace sd
 
         const LoadingRampData getLoadingRampData() const;
 
-        std::string getStructureRaport(size_t offset) const final;
+        void process(const size_t currentTime);
+
+        DestinationNode *passProduct()
+        {
+            return SourceNode::passProduct(getNodeState());
+        }
+
+        void skip(const size_t ticks);
+
+        void writeStructureRaport(IRaportSink &sink, size_t offset) const final;
 
         std::string toString() const final;
 
         NodeType getNodeType() const final;
 
-      protected:
-        void triggerOperation() final;
+        void saveCheckpoint(BinaryWriter &writer) const;
+        void loadCheckpoint(BinaryReader &reader);
 
       private:
+        void triggerOperation();
         Product::Ptr createProduct() const;
     };
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace sd
+{
+    class MappedFile
+    {
+      private:
+        std::filesystem::path _path;
+#ifdef _WIN32
+        void *_file = nullptr;
+        void *_mapping = nullptr;
+#else
+        int _file = -1;
+#endif
+        const char *_data = nullptr;
+        size_t _size = 0;
+
+      public:
+        MappedFile(const std::filesystem::path &path);
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        ~MappedFile();
+
+        std::string_view getView() const;
+        size_t getSize() const;
+
+      private:
+        void close();
+    };
+} // namespace sd
\ No newline at end of file
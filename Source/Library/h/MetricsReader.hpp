@@ -0,0 +1,39 @@
+#pragma once
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <vector>
+
+#include "MetricsRecorder.hpp"
+
+namespace sd
+{
+    class MetricsReader
+    {
+      private:
+        std::ifstream _file;
+        std::streamoff _dataOffset = 0;
+        size_t _firstSampleTime = 0;
+        size_t _interval = 0;
+        size_t _window = 0;
+        size_t _rowSize = 0;
+        std::vector<MetricsRecorder::Column> _columns;
+        std::vector<size_t> _columnOffsets;
+
+      public:
+        MetricsReader(const std::filesystem::path &path);
+
+        size_t getFirstSampleTime() const;
+        size_t getInterval() const;
+        size_t getWindow() const;
+        size_t getRowTime(size_t row) const;
+
+        const std::vector<MetricsRecorder::Column> &getColumns() const;
+        std::optional<size_t> findColumn(NodeType nodeType, size_t nodeId, MetricsRecorder::Metric metric) const;
+
+        std::vector<double> readColumn(size_t column);
+
+      private:
+        void readHeader();
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <vector>
+
+#include "BinaryStream.hpp"
+#include "StoreHouse.hpp"
+#include "Worker.hpp"
+
+namespace sd
+{
+    class MetricsRecorder
+    {
+      public:
+        enum Metric : uint8_t
+        {
+            QUEUE_LENGTH,
+            BUSY,
+            QUEUE_MIN,
+            QUEUE_MAX,
+            QUEUE_MEAN,
+            BUSY_RATIO
+        };
+
+        struct Column
+        {
+            NodeType nodeType;
+            size_t nodeId;
+            Metric metric;
+        };
+
+        static constexpr std::array<char, 4> Magic = {'S', 'D', 'M', 'T'};
+        static constexpr uint8_t Version = 1;
+        static constexpr size_t RowGroupBytes = 4 << 20;
+
+      private:
+        struct Source
+        {
+            const DestinationNode *node;
+            const Worker *worker;
+        };
+
+        struct Window
+        {
+            uint32_t min = 0;
+            uint32_t max = 0;
+            uint64_t sum = 0;
+            size_t busy = 0;
+        };
+
+        std::ofstream _file;
+        BinaryWriter _writer;
+        const size_t _interval;
+        const size_t _window;
+        size_t _rowsPerGroup = 0;
+        size_t _rows = 0;
+        size_t _windowSamples = 0;
+        bool _closed = false;
+
+        std::vector<Source> _sources;
+        std::vector<Column> _columns;
+        std::vector<std::vector<char>> _buffers;
+        std::vector<Window> _windows;
+
+      public:
+        MetricsRecorder(const std::filesystem::path &path, const std::vector<Worker *> &workers,
+                        const std::vector<StoreHouse *> &storeHouses, size_t startTime, size_t interval,
+                        size_t window = 0);
+        MetricsRecorder(const MetricsRecorder &) = delete;
+        MetricsRecorder &operator=(const MetricsRecorder &) = delete;
+        ~MetricsRecorder();
+
+        static size_t getValueSize(Metric metric);
+
+        bool isSampleTime(size_t time) const;
+        size_t getNextSampleTime(size_t time) const;
+
+        const std::vector<Column> &getColumns() const;
+
+        void sample();
+        void close();
+
+      private:
+        void addSource(const DestinationNode &node, const Worker *worker);
+
+        template <class T> void appendValue(size_t column, T value);
+        void appendRow();
+        void flushRowGroup();
+    };
+} // namespace sd
\ No newline at end of file
@@ -1,29 +1,78 @@
 #pragma once
-#include <deque>
+#include <limits>
 #include <memory>
+#include <unordered_set>
 
 
+#include "AliasTable.hpp"
 #include "Identifiable.hpp"
 #include "Interfaces.hpp"
 #include "Link.hpp"
+#include "NodeState.hpp"
 #include "Product.hpp"
+#include "RingBuffer.hpp"
 
 
 namespace sd
 {
     class Node : public Identifiable, public IToString, public IType
     {
+      private:
+        NodeState _state;
+
       public:
         using Ptr = std::shared_ptr<Node>;
         Node(size_t id);
+
+        void setContext(SimulationContext *context);
+        SimulationContext *getContext() const
+        {
+            return _state.context;
+        }
+
+        void setProductPool(ProductPool *productPool);
+        ProductPool *getProductPool() const
+        {
+            return _state.productPool;
+        }
+
+        void setTrace(EventTrace *trace);
+        EventTrace *getTrace() const
+        {
+            return _state.trace;
+        }
+
+        void setLatency(LatencyTracker *tracker, NodeLatency *latency = nullptr);
+        LatencyTracker *getLatencyTracker() const
+        {
+            return _state.latencyTracker;
+        }
+        NodeLatency *getLatency() const
+        {
+            return _state.latency;
+        }
+
+        IRandomDevice &getRandomDevice() const;
+
+        const NodeState &getState() const
+        {
+            return _state;
+        }
+
+      protected:
+        Product::Ptr acquireProduct(size_t id) const;
     };
 
     class SourceNode : virtual public Node, virtual public IStructureRaportable
     {
       private:
+        static constexpr uint64_t NoLink = static_cast<uint64_t>(-1);
+
         Product::Ptr _product;
+        Link *_blockedLink = nullptr;
 
-        std::vector<Link::Ptr> _links;
+        std::vector<Link *> _links;
+        AliasTable _aliasTable;
 
       public:
         using Ptr = std::shared_ptr<SourceNode>;
@@ -33,52 +82,104 @@ namespace sd
 
         void setProduct(Product::Ptr &&product);
 
-        void passProduct();
+        DestinationNode *passProduct();
+
+        Link &selectLink(double propability) const;
+        Product::Ptr releaseProduct();
+        DestinationNode &deliverProduct(Link &link, Product::Ptr &&product);
 
-        std::string getStructureRaport(size_t offset) const override;
+        void writeStructureRaport(IRaportSink &sink, size_t offset) const override;
 
-        void bindSourceLink(Link::Ptr link);
-        void unBindSourceLink(size_t id);
+        void bindSourceLink(Link &link);
+        void appendSourceLink(Link &link);
+        void normalize();
+        void unBindSourceLink(const Link &link);
+        void unBindSourceLinks(const std::unordered_set<Link *> &links);
 
         bool connectedSources() const;
 
         void unbindAllSources();
 
-        bool isProductReady() const;
+        bool isProductReady() const
+        {
+            return bool{_product};
+        }
 
-      private:
-        void normalize();
+        bool isBlocked() const
+        {
+            return _blockedLink;
+        }
+
+        DestinationNode *getBlockedDestination() const;
+
+        const std::vector<Link *> &getSourceLinks() const;
+        const AliasTable &getAliasTable() const;
 
-        Link::Ptr getRandomLink() const;
+        void saveCheckpoint(BinaryWriter &writer) const;
+        void loadCheckpoint(BinaryReader &reader);
+
+      protected:
+        // final node types pass the state reached through their CRTP base, skipping the virtual-base adjustment
+        DestinationNode *passProduct(const NodeState &state);
+        DestinationNode &deliverProduct(Link &link, Product::Ptr &&product, const NodeState &state);
+
+      private:
+        Link &getLink(double propability) const;
     };
 
     class DestinationNode : virtual public Node, virtual public IStructureRaportable, public IStateRaportable
     {
       private:
-        std::deque<Product::Ptr> _storedProducts;
+        RingBuffer<Product::Ptr> _storedProducts;
+        uint64_t _version = 0;
 
-        std::vector<Link::Ptr> _links;
+        std::vector<Link *> _links;
 
       public:
         using Ptr = std::shared_ptr<DestinationNode>;
         using RawPtr = DestinationNode *;
 
-        DestinationNode(size_t id);
+        DestinationNode(size_t id, size_t capacity = 0);
 
         void addProductToStore(Product::Ptr &&product);
 
         Product::Ptr getStoredProduct(bool first = false);
 
-        std::string getStateRaport(size_t offset) const override;
+        void writeStateRaport(IRaportSink &sink, size_t offset) const override;
 
-        void bindDestinationLink(Link::Ptr link);
-        void unBindDestinationLink(size_t id);
+        void bindDestinationLink(Link &link);
+        void unBindDestinationLink(const Link &link);
+        void unBindDestinationLinks(const std::unordered_set<Link *> &links);
 
         bool connectedDestinations() const;
 
         void unbindAllDestinations();
 
-        bool areProductsAvailable() const;
-        size_t getStoredProductsSize() const;
+        const std::vector<Link *> &getDestinationLinks() const;
+
+        bool areProductsAvailable() const
+        {
+            return !_storedProducts.empty();
+        }
+
+        size_t getStoredProductsSize() const
+        {
+            return _storedProducts.size();
+        }
+
+        const Product &getStoredProductAt(size_t index) const;
+        void appendStoredProductIds(std::vector<uint64_t> &ids,
+                                    size_t limit = std::numeric_limits<size_t>::max()) const;
+
+        bool isFull() const
+        {
+            return _storedProducts.full();
+        }
+        size_t getCapacity() const;
+
+        uint64_t getVersion() const;
+
+        void saveCheckpoint(BinaryWriter &writer, bool latency, size_t first = 0) const;
+        void loadCheckpoint(BinaryReader &reader, bool append = false);
     };
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+#include "Interfaces.hpp"
+
+namespace sd
+{
+    class SimulationContext;
+    class ProductPool;
+    class EventTrace;
+    class LatencyTracker;
+    struct NodeLatency;
+
+    // Flat simulation state of one node, read by the tick path of the final node types through their CRTP base.
+    struct NodeState
+    {
+        SimulationContext *context = nullptr;
+        ProductPool *productPool = nullptr;
+        EventTrace *trace = nullptr;
+        LatencyTracker *latencyTracker = nullptr;
+        NodeLatency *latency = nullptr;
+
+        IRandomDevice &getRandomDevice() const;
+    };
+} // namespace sd
\ No newline at end of file
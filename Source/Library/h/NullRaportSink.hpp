@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Interfaces.hpp"
+
+namespace sd
+{
+    class NullRaportSink final : public IRaportSink
+    {
+      public:
+        void beginRaport(size_t, bool) final
+        {
+        }
+
+        void beginSection(std::string_view) final
+        {
+        }
+
+        void beginNode(size_t, NodeType, size_t) final
+        {
+        }
+
+        void writeProperty(size_t, std::string_view, size_t) final
+        {
+        }
+
+        void writeProperty(size_t, std::string_view, std::string_view) final
+        {
+        }
+
+        void beginLinks(size_t) final
+        {
+        }
+
+        void writeLink(size_t, NodeType, size_t, double) final
+        {
+        }
+
+        void beginQueue(size_t) final
+        {
+        }
+
+        void writeCurrentProduct(uint64_t, size_t) final
+        {
+        }
+
+        void writeProduct(uint64_t) final
+        {
+        }
+
+        void writeQueueSummary(size_t, const QueueSummary &, size_t) final
+        {
+        }
+
+        void endNode() final
+        {
+        }
+
+        void beginLatencyRaport() final
+        {
+        }
+
+        void writeLatency(size_t, std::string_view, const LatencyStatistic &) final
+        {
+        }
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+
+#include "EventTrace.hpp"
+#include "LoadingRamp.hpp"
+#include "ThreadPool.hpp"
+#include "Worker.hpp"
+
+namespace sd
+{
+    class ParallelScheduler
+    {
+      private:
+        struct Delivery
+        {
+            Worker *source;
+            Link *link;
+            Product::Ptr product;
+        };
+
+        struct Chunk
+        {
+            size_t begin = 0;
+            size_t end = 0;
+            std::vector<size_t> readyWorkers;
+            std::vector<double> propabilities;
+            std::vector<Delivery> deliveries;
+            EventTrace trace;
+        };
+
+        std::vector<LoadingRamp *> _ramps;
+        std::vector<Worker *> _workers;
+        std::vector<Chunk> _chunks;
+        ThreadPool _pool;
+        bool _bounded = false;
+        EventTrace *_trace;
+
+      public:
+        ParallelScheduler(std::vector<LoadingRamp *> ramps, std::vector<Worker *> workers, size_t threadsCount,
+                          EventTrace *trace = nullptr);
+        ~ParallelScheduler();
+
+        void tick(size_t time);
+
+      private:
+        void drawPropabilities();
+        void deliverProducts();
+        void mergeTraces();
+
+        void passFromWorkersInOrder();
+        void passFromWorkers(Chunk &chunk);
+        void processWorkers(Chunk &chunk, size_t time);
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Factory.hpp"
+#include "ReplicationRunner.hpp"
+
+namespace sd
+{
+    class ParameterSweep
+    {
+      public:
+        enum ParameterTarget
+        {
+            WORKER_PROCESSING_TIME,
+            RAMP_DELIVERY_INTERVAL,
+            LINK_PROBABILITY
+        };
+
+        struct Parameter
+        {
+            ParameterTarget target;
+            size_t id;
+            std::vector<double> values;
+
+            static Parameter parse(const std::string &definition);
+
+            std::string getName() const;
+        };
+
+        struct VariantResult
+        {
+            std::vector<double> values;
+            ReplicationRunner::Statistic throughput;
+            double queuedProducts;
+            double storedProducts;
+        };
+
+      private:
+        FactoryStructure _structure;
+        std::vector<Parameter> _parameters;
+        size_t _replicas;
+        uint64_t _seed;
+        size_t _maxIterations = 0;
+        std::vector<VariantResult> _results;
+
+      public:
+        ParameterSweep(const Factory &factory, std::vector<Parameter> parameters, size_t replicas, uint64_t seed);
+
+        void run(size_t maxIterations, const RunOptions &options);
+
+        size_t getVariantsCount() const;
+        std::vector<double> getVariantValues(size_t variant) const;
+        FactoryStructure createVariant(size_t variant) const;
+
+        const std::vector<VariantResult> &getResults() const;
+
+        std::string generateResultsTable() const;
+
+      private:
+        void checkParameter(const Parameter &parameter) const;
+    };
+} // namespace sd
\ No newline at end of file
@@ -1,32 +1,98 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 
-#include "Interfaces.hpp"
+#include "BinaryStream.hpp"
 
 namespace sd
 {
+    struct NodeState;
 
-    class Processable : public IProcessable
+    template <class Derived> class Processable
     {
       private:
         const size_t _totalProcessTime;
-        size_t _currentProcessTime;
-        bool _stopped;
+        size_t _currentProcessTime = 0;
+        bool _stopped = false;
 
       public:
-        Processable(size_t processTime);
+        explicit Processable(size_t processTime) : _totalProcessTime(processTime)
+        {
+        }
 
-        void process(const size_t currentTime) override;
+        void process(const size_t)
+        {
+            if (!_stopped && (++_currentProcessTime >= _totalProcessTime))
+            {
+                static_cast<Derived &>(*this).triggerOperation();
+                resetProcessTime();
+            }
+        }
+
+        void skip(const size_t ticks)
+        {
+            if (!_stopped)
+            {
+                _currentProcessTime += ticks;
+            }
+        }
+
+        size_t getRemainingProcesingTime() const
+        {
+            return _totalProcessTime > _currentProcessTime ? _totalProcessTime - _currentProcessTime : 1;
+        }
+
+        size_t getCurrentProcesingTime() const
+        {
+            return _currentProcessTime;
+        }
+
+        void saveCheckpoint(BinaryWriter &writer) const
+        {
+            writer.write<uint64_t>(_currentProcessTime);
+            writer.write<uint8_t>(_stopped);
+        }
+
+        void loadCheckpoint(BinaryReader &reader)
+        {
+            _currentProcessTime = reader.read<uint64_t>();
+            _stopped = reader.read<uint8_t>() != 0;
+        }
+
+        void restore(size_t currentProcessTime, bool stopped)
+        {
+            _currentProcessTime = currentProcessTime;
+            _stopped = stopped;
+        }
 
       protected:
-        size_t getTotalProcesingTime() const;
+        // the derived node type is final, so its Node base is reached without a virtual-base adjustment
+        const NodeState &getNodeState() const
+        {
+            return static_cast<const Derived &>(*this).getState();
+        }
 
-        size_t getCurrentProcesingTime() const;
+        size_t getTotalProcesingTime() const
+        {
+            return _totalProcessTime;
+        }
 
-        void stop();
+        void stop()
+        {
+            _stopped = true;
+            resetProcessTime();
+        }
 
-        void reset();
+        void reset()
+        {
+            _stopped = false;
+            resetProcessTime();
+        }
 
       private:
-        void resetProcessTime();
+        void resetProcessTime()
+        {
+            _currentProcessTime = 0;
+        }
     };
 } // namespace sd
\ No newline at end of file
@@ -1,23 +1,68 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
+#include "BinaryStream.hpp"
 #include "Identifiable.hpp"
-#include "Interfaces.hpp"
 
 
 namespace sd
 {
-    class Product final : public Identifiable, public IToString
+    class ProductPool;
+
+    class Product final : public Identifiable
     {
       private:
+        static constexpr uint64_t NoProduct = static_cast<uint64_t>(-1);
+
         static size_t _idSeed;
 
+        size_t _creationTime = 0;
+        uint32_t _enqueueTime = 0;
+        uint32_t _serviceTime = 0;
+        // pool the product returns to, kept here so Ptr stays as small as a raw pointer
+        ProductPool *_pool = nullptr;
+
+        friend class ProductPool;
+
       public:
-        using Ptr = std::unique_ptr<Product>;
+        struct Deleter
+        {
+            Deleter() = default;
+            Deleter(const std::default_delete<Product> &);
+
+            void operator()(Product *product) const;
+        };
+
+        using Ptr = std::unique_ptr<Product, Deleter>;
 
         Product();
+        explicit Product(size_t id);
+
+        std::string toString() const;
+
+        size_t getCreationTime() const;
+        void setCreationTime(size_t creationTime);
+
+        size_t getEnqueueTime() const;
+        void setEnqueueTime(size_t enqueueTime);
+
+        size_t getServiceTime() const;
+        void addServiceTime(size_t serviceTime);
+
+        static Ptr create(size_t id, ProductPool *pool = nullptr);
+        static size_t generateId();
+
+        static size_t getIdSeed();
+        static void setIdSeed(size_t idSeed);
+
+        static void saveCheckpoint(BinaryWriter &writer, const Ptr &product);
+        static Ptr loadCheckpoint(BinaryReader &reader, ProductPool *pool = nullptr);
+
+      private:
+        Product(size_t id, ProductPool *pool);
 
-        std::string toString() const final;
+        static uint32_t saturate(size_t value);
     };
 } // namespace sd
\ No newline at end of file
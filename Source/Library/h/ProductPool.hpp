@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Product.hpp"
+
+namespace sd
+{
+    class ProductPool
+    {
+      private:
+        struct alignas(Product) Slot
+        {
+            std::byte storage[sizeof(Product)];
+        };
+
+        static constexpr size_t SlabSize = 1024;
+
+        std::vector<std::unique_ptr<Slot[]>> _slabs;
+        std::vector<Slot *> _freeSlots;
+        size_t _slabUsed = SlabSize;
+        size_t _liveCount = 0;
+
+      public:
+        ProductPool() = default;
+        ProductPool(const ProductPool &) = delete;
+        ProductPool &operator=(const ProductPool &) = delete;
+
+        Product::Ptr create(size_t id);
+        void release(Product *product);
+
+        size_t getLiveCount() const;
+        size_t getCapacity() const;
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace sd
+{
+    class DestinationNode;
+
+    struct QueueSummary
+    {
+        static constexpr size_t SamplesCount = 256;
+
+        size_t length = 0;
+        uint64_t oldestProduct = 0;
+        uint64_t newestProduct = 0;
+        size_t ageP50 = 0;
+        size_t ageP90 = 0;
+        size_t ageP99 = 0;
+
+        static QueueSummary create(const DestinationNode &node, size_t time);
+    };
+} // namespace sd
\ No newline at end of file
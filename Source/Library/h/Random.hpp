@@ -17,6 +17,23 @@ namespace sd
       public:
         NormalRandomDevice();
         double next() final;
+
+        std::string saveState() const final;
+        void loadState(const std::string &state) final;
+    };
+
+    class SeededRandomDevice final : public IRandomDevice
+    {
+      private:
+        std::mt19937_64 _eng;
+        std::uniform_real_distribution<double> _distr;
+
+      public:
+        SeededRandomDevice(uint64_t seed, uint64_t stream = 0);
+        double next() final;
+
+        std::string saveState() const final;
+        void loadState(const std::string &state) final;
     };
 
     class Random final : public IRandomDevice
@@ -31,5 +48,8 @@ namespace sd
 
         void updateRandomDevice(std::unique_ptr<IRandomDevice> newRandomDevice);
         double next() final;
+
+        std::string saveState() const final;
+        void loadState(const std::string &state) final;
     };
 } // namespace sd
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace sd
+{
+    class RaportReconstructor
+    {
+      private:
+        std::istream &_in;
+        std::ostream &_out;
+        std::optional<std::string> _line;
+        size_t _lineNumber = 0;
+
+        std::map<size_t, std::string> _workers;
+        std::map<size_t, std::string> _storeHouses;
+        bool _initialized = false;
+
+      public:
+        RaportReconstructor(std::istream &in, std::ostream &out);
+
+        void run();
+
+      private:
+        void readRaport(size_t time, bool delta);
+        void readNodes(std::map<size_t, std::string> &nodes, const std::string &prefix);
+        void writeRaport(size_t time);
+
+        const std::optional<std::string> &peek();
+        std::string next();
+        void expect(const std::string &line);
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Interfaces.hpp"
+#include "QueueSummary.hpp"
+
+namespace sd
+{
+    struct RaportSnapshot
+    {
+        static constexpr uint64_t NoProduct = static_cast<uint64_t>(-1);
+
+        struct WorkerState
+        {
+            size_t id;
+            uint64_t currentProduct;
+            size_t processingTime;
+            size_t productsEnd;
+        };
+
+        struct StoreHouseState
+        {
+            size_t id;
+            size_t productsEnd;
+        };
+
+        size_t time = 0;
+        bool delta = false;
+        bool summary = false;
+        std::vector<WorkerState> workers;
+        std::vector<StoreHouseState> storeHouses;
+        std::vector<uint64_t> products;
+        std::vector<QueueSummary> summaries;
+
+        void clear();
+
+        void replay(IRaportSink &sink) const;
+
+      private:
+        void replayProducts(IRaportSink &sink, size_t begin, size_t end, size_t summaryIndex) const;
+    };
+} // namespace sd
\ No newline at end of file
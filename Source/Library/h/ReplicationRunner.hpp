@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Factory.hpp"
+
+namespace sd
+{
+    class ReplicationRunner
+    {
+      public:
+        struct Statistic
+        {
+            double mean;
+            double variance;
+            double confidenceLow;
+            double confidenceHigh;
+        };
+
+        struct ReplicaResult
+        {
+            std::vector<size_t> workerQueueLengths;
+            std::vector<size_t> storeHouseCounts;
+            double throughput;
+        };
+
+      private:
+        FactoryStructure _structure;
+        size_t _replicas;
+        uint64_t _seed;
+        size_t _maxIterations = 0;
+        std::vector<ReplicaResult> _results;
+
+      public:
+        ReplicationRunner(const Factory &factory, size_t replicas, uint64_t seed);
+
+        void run(size_t maxIterations, const RunOptions &options);
+
+        const std::vector<ReplicaResult> &getResults() const;
+
+        std::string generateStatisticsRaport() const;
+
+        static Statistic computeStatistic(const std::vector<double> &samples);
+
+        static SimulationContext::Ptr createReplicaContext(uint64_t seed, size_t replica);
+
+        static ReplicaResult runReplica(const FactoryStructure &structure, uint64_t seed, size_t replica,
+                                        size_t maxIterations, const RunOptions &options);
+        static ReplicaResult collectResult(const Factory &factory, size_t maxIterations);
+
+      private:
+
+        template <class Getter> Statistic collectStatistic(Getter getter) const
+        {
+            std::vector<double> samples;
+            samples.reserve(_results.size());
+            for (auto &result : _results)
+            {
+                samples.push_back(static_cast<double>(getter(result)));
+            }
+            return computeStatistic(samples);
+        }
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,118 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace sd
+{
+    template <class T> class RingBuffer
+    {
+      private:
+        static constexpr size_t InitialCapacity = 16;
+
+        std::vector<T> _buffer;
+        size_t _head = 0;
+        size_t _size = 0;
+        size_t _capacity;
+
+      public:
+        explicit RingBuffer(size_t capacity = 0) : _buffer(capacity), _capacity(capacity)
+        {
+        }
+
+        bool isBounded() const
+        {
+            return _capacity > 0;
+        }
+
+        size_t capacity() const
+        {
+            return _capacity;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        bool empty() const
+        {
+            return _size == 0;
+        }
+
+        bool full() const
+        {
+            return isBounded() && _size == _capacity;
+        }
+
+        void push_back(T &&value)
+        {
+            if (_size == _buffer.size())
+            {
+                if (isBounded())
+                {
+                    throw std::runtime_error("Ring buffer is full");
+                }
+                grow();
+            }
+            _buffer[wrap(_head + _size)] = std::move(value);
+            ++_size;
+        }
+
+        T pop_front()
+        {
+            checkEmpty();
+            auto value = std::move(_buffer[_head]);
+            _head = wrap(_head + 1);
+            --_size;
+            return value;
+        }
+
+        T pop_back()
+        {
+            checkEmpty();
+            --_size;
+            return std::move(_buffer[wrap(_head + _size)]);
+        }
+
+        const T &operator[](size_t index) const
+        {
+            return _buffer[wrap(_head + index)];
+        }
+
+        void clear()
+        {
+            while (!empty())
+            {
+                pop_back();
+            }
+            _head = 0;
+        }
+
+      private:
+        size_t wrap(size_t index) const
+        {
+            return index >= _buffer.size() ? index - _buffer.size() : index;
+        }
+
+        void checkEmpty() const
+        {
+            if (empty())
+            {
+                throw std::runtime_error("Ring buffer is empty");
+            }
+        }
+
+        void grow()
+        {
+            std::vector<T> grown(_buffer.empty() ? InitialCapacity : _buffer.size() * 2);
+            for (size_t index = 0; index < _size; ++index)
+            {
+                grown[index] = std::move(_buffer[wrap(_head + index)]);
+            }
+            _buffer.swap(grown);
+            _head = 0;
+        }
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include "Interfaces.hpp"
+#include "ThreadPool.hpp"
+#include "Utils.hpp"
+
+namespace sd
+{
+    struct RunOptions
+    {
+        SimulationEngine engine = SimulationEngine::TICK;
+        size_t threads = ThreadPool::getDefaultThreadsCount();
+
+        size_t startTime = 0;
+        bool structureRaport = true;
+        std::optional<std::string> checkpointFile = std::nullopt;
+        size_t checkpointInterval = 0;
+
+        std::optional<std::string> traceFile = std::nullopt;
+
+        std::optional<std::string> metricsFile = std::nullopt;
+        size_t metricsInterval = 1;
+        size_t metricsWindow = 0;
+
+        bool trackLatency = false;
+
+        size_t pendingRaports = 4;
+        RaportMode raportMode = RaportMode::FULL;
+        size_t keyframeInterval = 10;
+        size_t summaryProductsLimit = 10;
+        IRaportSink *raportSink = nullptr;
+    };
+} // namespace sd
\ No newline at end of file
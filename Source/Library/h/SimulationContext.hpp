@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include "Interfaces.hpp"
+#include "Product.hpp"
+
+namespace sd
+{
+    class SimulationContext
+    {
+      private:
+        std::unique_ptr<IRandomDevice> _randomDevice;
+        size_t _productIdSeed;
+
+      public:
+        using Ptr = std::shared_ptr<SimulationContext>;
+
+        SimulationContext(std::unique_ptr<IRandomDevice> randomDevice, size_t productIdSeed = 0);
+
+        IRandomDevice &getRandomDevice() const;
+
+        size_t createProductId();
+
+        size_t getProductIdSeed() const;
+        void setProductIdSeed(size_t productIdSeed);
+    };
+} // namespace sd
\ No newline at end of file
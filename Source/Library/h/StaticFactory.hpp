@@ -0,0 +1,629 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <format>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "AliasTable.hpp"
+#include "Factory.hpp"
+#include "Interfaces.hpp"
+
+namespace sd
+{
+    template <size_t RampsCount, size_t WorkersCount, size_t StoreHousesCount, size_t LinksCount>
+    struct StaticStructure
+    {
+        std::array<LoadingRampData, RampsCount> loadingRamps;
+        std::array<WorkerData, WorkersCount> workers;
+        std::array<StoreHouseData, StoreHousesCount> storeHouses;
+        std::array<LinkData, LinksCount> links;
+    };
+
+    enum class StaticStructureRule
+    {
+        VALID,
+        DUPLICATED_RAMP,
+        DUPLICATED_WORKER,
+        DUPLICATED_STOREHOUSE,
+        STOREHOUSE_AS_SOURCE,
+        MISSING_RAMP_SOURCE,
+        MISSING_WORKER_SOURCE,
+        RAMP_AS_DESTINATION,
+        MISSING_STOREHOUSE_DESTINATION,
+        MISSING_WORKER_DESTINATION,
+        RAMP_TO_STOREHOUSE,
+        NOT_POSITIVE_PROBABILITY,
+        DUPLICATED_LINK,
+        WORKER_NOT_SOURCE,
+        WORKER_NOT_DESTINATION,
+        RAMP_NOT_SOURCE,
+        STOREHOUSE_NOT_DESTINATION,
+        BOUNDED_QUEUE,
+    };
+
+    struct StaticStructureError
+    {
+        StaticStructureRule rule = StaticStructureRule::VALID;
+        size_t id = 0;
+
+        constexpr bool valid() const
+        {
+            return rule == StaticStructureRule::VALID;
+        }
+
+        std::string toString() const
+        {
+            switch (rule)
+            {
+            case StaticStructureRule::DUPLICATED_RAMP:
+                return std::format("Loading ramp of id {} was already created.", id);
+            case StaticStructureRule::DUPLICATED_WORKER:
+                return std::format("Worker of id {} was already created.", id);
+            case StaticStructureRule::DUPLICATED_STOREHOUSE:
+                return std::format("Storehouse of id {} was already created.", id);
+            case StaticStructureRule::STOREHOUSE_AS_SOURCE:
+                return "Storehouse cannot be used as link source.";
+            case StaticStructureRule::MISSING_RAMP_SOURCE:
+                return std::format("Could not find LoadingRamp of id {} to be link source.", id);
+            case StaticStructureRule::MISSING_WORKER_SOURCE:
+                return std::format("Could not find Worker of id {} to be link source.", id);
+            case StaticStructureRule::RAMP_AS_DESTINATION:
+                return "LoadingRamp cannot be used as link destination.";
+            case StaticStructureRule::MISSING_STOREHOUSE_DESTINATION:
+                return std::format("Could not find Storehouse of id {} to be link destination.", id);
+            case StaticStructureRule::MISSING_WORKER_DESTINATION:
+                return std::format("Could not find Worker of id {} to be link destination.", id);
+            case StaticStructureRule::RAMP_TO_STOREHOUSE:
+                return "Cannot bind Ramp and Store.";
+            case StaticStructureRule::NOT_POSITIVE_PROBABILITY:
+                return "Probability Cannot be set to 0.";
+            case StaticStructureRule::DUPLICATED_LINK:
+                return std::format("Link of id {} was already created.", id);
+            case StaticStructureRule::WORKER_NOT_SOURCE:
+                return std::format("Worker of id {} is not connected as source.", id);
+            case StaticStructureRule::WORKER_NOT_DESTINATION:
+                return std::format("Worker of id {} is not connected as destination.", id);
+            case StaticStructureRule::RAMP_NOT_SOURCE:
+                return std::format("Ramp of id {} is not connected as source.", id);
+            case StaticStructureRule::STOREHOUSE_NOT_DESTINATION:
+                return std::format("StoreHouse of id {} is not connected as destination.", id);
+            case StaticStructureRule::BOUNDED_QUEUE:
+                return "Factory with bounded queues cannot be compiled.";
+            default:
+                return "";
+            }
+        }
+    };
+
+    template <class Nodes> constexpr auto getIdOrder(const Nodes &nodes)
+    {
+        std::array<size_t, std::tuple_size_v<Nodes>> order{};
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::sort(order.begin(), order.end(),
+                  [&](size_t left, size_t right) { return nodes[left].id < nodes[right].id; });
+        return order;
+    }
+
+    // Applies the rules of Factory::addStructure, Link and Factory::validate in the same order
+    template <class Structure> constexpr StaticStructureError checkStaticStructure(const Structure &structure)
+    {
+        auto findDuplicate = [](const auto &items) -> const size_t * {
+            for (size_t index = 0; index < items.size(); ++index)
+            {
+                for (size_t other = 0; other < index; ++other)
+                {
+                    if (items[other].id == items[index].id)
+                    {
+                        return &items[index].id;
+                    }
+                }
+            }
+            return nullptr;
+        };
+        auto contains = [](const auto &nodes, size_t id) {
+            return std::any_of(nodes.begin(), nodes.end(), [&](auto &node) { return node.id == id; });
+        };
+        auto isBound = [&](const LinkBind &bind, bool asSource) {
+            return std::any_of(structure.links.begin(), structure.links.end(), [&](auto &link) {
+                auto &linkBind = asSource ? link.source : link.destination;
+                return linkBind.id == bind.id && linkBind.type == bind.type;
+            });
+        };
+
+        if (auto id = findDuplicate(structure.loadingRamps))
+        {
+            return {StaticStructureRule::DUPLICATED_RAMP, *id};
+        }
+        if (auto id = findDuplicate(structure.workers))
+        {
+            return {StaticStructureRule::DUPLICATED_WORKER, *id};
+        }
+        if (auto id = findDuplicate(structure.storeHouses))
+        {
+            return {StaticStructureRule::DUPLICATED_STOREHOUSE, *id};
+        }
+        for (size_t index = 0; index < structure.links.size(); ++index)
+        {
+            auto &link = structure.links[index];
+            if (link.source.type == NodeType::STORE)
+            {
+                return {StaticStructureRule::STOREHOUSE_AS_SOURCE, link.id};
+            }
+            if (link.source.type == NodeType::RAMP && !contains(structure.loadingRamps, link.source.id))
+            {
+                return {StaticStructureRule::MISSING_RAMP_SOURCE, link.source.id};
+            }
+            if (link.source.type == NodeType::WORKER && !contains(structure.workers, link.source.id))
+            {
+                return {StaticStructureRule::MISSING_WORKER_SOURCE, link.source.id};
+            }
+            if (link.destination.type == NodeType::RAMP)
+            {
+                return {StaticStructureRule::RAMP_AS_DESTINATION, link.id};
+            }
+            if (link.destination.type == NodeType::STORE && !contains(structure.storeHouses, link.destination.id))
+            {
+                return {StaticStructureRule::MISSING_STOREHOUSE_DESTINATION, link.destination.id};
+            }
+            if (link.destination.type == NodeType::WORKER && !contains(structure.workers, link.destination.id))
+            {
+                return {StaticStructureRule::MISSING_WORKER_DESTINATION, link.destination.id};
+            }
+            if (link.source.type == NodeType::RAMP && link.destination.type == NodeType::STORE)
+            {
+                return {StaticStructureRule::RAMP_TO_STOREHOUSE, link.id};
+            }
+            if (link.probability <= 0)
+            {
+                return {StaticStructureRule::NOT_POSITIVE_PROBABILITY, link.id};
+            }
+            for (size_t other = 0; other < index; ++other)
+            {
+                if (structure.links[other].id == link.id)
+                {
+                    return {StaticStructureRule::DUPLICATED_LINK, link.id};
+                }
+            }
+        }
+
+        for (auto index : getIdOrder(structure.workers))
+        {
+            auto id = structure.workers[index].id;
+            if (!isBound({id, NodeType::WORKER}, true))
+            {
+                return {StaticStructureRule::WORKER_NOT_SOURCE, id};
+            }
+            if (!isBound({id, NodeType::WORKER}, false))
+            {
+                return {StaticStructureRule::WORKER_NOT_DESTINATION, id};
+            }
+        }
+        for (auto index : getIdOrder(structure.loadingRamps))
+        {
+            auto id = structure.loadingRamps[index].id;
+            if (!isBound({id, NodeType::RAMP}, true))
+            {
+                return {StaticStructureRule::RAMP_NOT_SOURCE, id};
+            }
+        }
+        for (auto index : getIdOrder(structure.storeHouses))
+        {
+            auto id = structure.storeHouses[index].id;
+            if (!isBound({id, NodeType::STORE}, false))
+            {
+                return {StaticStructureRule::STOREHOUSE_NOT_DESTINATION, id};
+            }
+        }
+
+        for (auto &worker : structure.workers)
+        {
+            if (worker.capacity > 0)
+            {
+                return {StaticStructureRule::BOUNDED_QUEUE, worker.id};
+            }
+        }
+        for (auto &store : structure.storeHouses)
+        {
+            if (store.capacity > 0)
+            {
+                return {StaticStructureRule::BOUNDED_QUEUE, store.id};
+            }
+        }
+        return {};
+    }
+
+    // Instantiated with the check result, so a failing build names the broken rule and node id
+    template <StaticStructureError Error> struct StaticStructureCheck
+    {
+        static_assert(Error.valid(), "Static factory structure is invalid.");
+    };
+
+    // QueueCapacity bounds the fixed part of every worker queue. Products past it spill to heap storage, so such
+    // runs still match Factory::run, but their ticks allocate. Storehouses never drain and share one arena that
+    // run() reserves up front for every product the run can deliver, so storehouse arrivals never allocate.
+    template <auto Structure, size_t QueueCapacity = 1024> class StaticFactory
+    {
+      private:
+        static_assert(sizeof(StaticStructureCheck<checkStaticStructure(Structure)>) > 0);
+        static_assert(QueueCapacity > 0, "Static factory queues need capacity.");
+
+        static constexpr size_t NoProduct = static_cast<size_t>(-1);
+        static constexpr size_t RampsCount = Structure.loadingRamps.size();
+        static constexpr size_t WorkersCount = Structure.workers.size();
+        static constexpr size_t StoreHousesCount = Structure.storeHouses.size();
+        static constexpr size_t LinksCount = Structure.links.size();
+
+        static constexpr auto RampOrder = getIdOrder(Structure.loadingRamps);
+        static constexpr auto WorkerOrder = getIdOrder(Structure.workers);
+        static constexpr auto StoreOrder = getIdOrder(Structure.storeHouses);
+
+        // sources are indexed ramps first, then workers, destinations workers first, then storehouses
+        struct SourceLinks
+        {
+            std::array<size_t, RampsCount + WorkersCount + 1> offsets{};
+            std::array<size_t, LinksCount> destinations{};
+            std::array<double, LinksCount> aliasProbabilities{};
+            std::array<size_t, LinksCount> aliases{};
+        };
+
+        // products past the fixed part are kept in spill, which is empty unless the fixed part is full
+        struct Queue
+        {
+            std::array<size_t, QueueCapacity> products;
+            size_t head = 0;
+            size_t size = 0;
+            std::deque<size_t> spill;
+        };
+
+        // storehouse products are kept in arrival order and chained per storehouse
+        struct StoredProduct
+        {
+            size_t product;
+            size_t next;
+        };
+
+        std::array<size_t, RampsCount> _rampCounters{};
+        std::array<size_t, WorkersCount> _workerCounters{};
+        std::array<size_t, WorkersCount> _workerCurrentProducts{};
+        std::array<size_t, WorkersCount> _workerReadyProducts{};
+        std::array<Queue, WorkersCount> _queues{};
+        std::vector<StoredProduct> _storedProducts;
+        std::array<size_t, StoreHousesCount> _storeHeads{};
+        std::array<size_t, StoreHousesCount> _storeTails{};
+
+        size_t _productIdSeed = 0;
+        SimulationContext::Ptr _context;
+        std::string _structureRaport;
+
+      public:
+        explicit StaticFactory(SimulationContext::Ptr context = nullptr)
+            : _context(std::move(context)), _structureRaport(Factory{getStructure()}.generateStructureRaport())
+        {
+            reset();
+        }
+
+        static FactoryStructure getStructure()
+        {
+            return {{Structure.loadingRamps.begin(), Structure.loadingRamps.end()},
+                    {Structure.workers.begin(), Structure.workers.end()},
+                    {Structure.storeHouses.begin(), Structure.storeHouses.end()},
+                    {Structure.links.begin(), Structure.links.end()}};
+        }
+
+        // Writes the same raports as Factory::run with default options
+        void run(size_t maxIterations, std::ostream &raportOutStream, const Factory::RaportGuard &raportGuard,
+                 IRandomDevice &randomDevice)
+        {
+            raportOutStream << "========= Factory Structure ========" << std::endl;
+            raportOutStream << _structureRaport << std::endl;
+            raportOutStream << "========= Simulation Start =========" << std::endl;
+            _storedProducts.reserve(_storedProducts.size() + getDeliveredProductsBound(maxIterations));
+            _productIdSeed = _context ? _context->getProductIdSeed() : Product::getIdSeed();
+            for (size_t time = 0; time < maxIterations; ++time)
+            {
+                tick(randomDevice);
+
+                if (raportGuard.isRaportTime(time))
+                {
+                    raportOutStream << std::format("========= Iteration: {} =========", time) << std::endl;
+                    raportOutStream << generateStateRaport();
+                }
+            }
+            if (_context)
+            {
+                _context->setProductIdSeed(_productIdSeed);
+            }
+            else
+            {
+                Product::setIdSeed(_productIdSeed);
+            }
+        }
+
+        void reset()
+        {
+            _rampCounters.fill(0);
+            _workerCounters.fill(0);
+            _workerCurrentProducts.fill(NoProduct);
+            _workerReadyProducts.fill(NoProduct);
+            for (auto &queue : _queues)
+            {
+                queue.head = 0;
+                queue.size = 0;
+                queue.spill.clear();
+            }
+            _storedProducts.clear();
+            _storeHeads.fill(NoProduct);
+            _storeTails.fill(NoProduct);
+        }
+
+        std::string generateStateRaport() const
+        {
+            std::string out = "== WORKERS ==\n\n";
+            auto inserter = std::back_inserter(out);
+            for (size_t worker = 0; worker < WorkersCount; ++worker)
+            {
+                std::format_to(inserter, "WORKER #{}\n\tQueue: ", Structure.workers[WorkerOrder[worker]].id);
+                if (_workerCurrentProducts[worker] != NoProduct)
+                {
+                    std::format_to(inserter, "#{} (pt = {}), ", _workerCurrentProducts[worker],
+                                   _workerCounters[worker]);
+                }
+                appendQueue(out, _queues[worker]);
+                out += "\n\n";
+            }
+            out += "== STOREHOUSES ==\n\n";
+            for (size_t store = 0; store < StoreHousesCount; ++store)
+            {
+                std::format_to(inserter, "STOREHOUSE #{}\n\tQueue: ", Structure.storeHouses[StoreOrder[store]].id);
+                appendStoredProducts(out, store);
+                out += "\n\n";
+            }
+            return out;
+        }
+
+      private:
+        // every product already in flight and every product the ramps can deliver during the run
+        size_t getDeliveredProductsBound(size_t maxIterations) const
+        {
+            size_t bound = 0;
+            for (auto &ramp : Structure.loadingRamps)
+            {
+                bound += maxIterations / std::max<size_t>(ramp.deliveryInterval, 1) + 1;
+            }
+            for (size_t worker = 0; worker < WorkersCount; ++worker)
+            {
+                bound += _queues[worker].size + _queues[worker].spill.size();
+                bound += (_workerCurrentProducts[worker] != NoProduct) + (_workerReadyProducts[worker] != NoProduct);
+            }
+            return bound;
+        }
+
+        void tick(IRandomDevice &randomDevice)
+        {
+            [&]<size_t... Ramps>(std::index_sequence<Ramps...>) {
+                (tickRamp<Ramps>(randomDevice), ...);
+            }(std::make_index_sequence<RampsCount>{});
+            [&]<size_t... Workers>(std::index_sequence<Workers...>) {
+                (passReadyProduct<Workers>(randomDevice), ...);
+                (processWorker<Workers>(), ...);
+            }(std::make_index_sequence<WorkersCount>{});
+        }
+
+        template <size_t Ramp> void tickRamp(IRandomDevice &randomDevice)
+        {
+            constexpr auto deliveryInterval = Structure.loadingRamps[RampOrder[Ramp]].deliveryInterval;
+            if (++_rampCounters[Ramp] >= deliveryInterval)
+            {
+                _rampCounters[Ramp] = 0;
+                passProduct<Ramp>(_productIdSeed++, randomDevice);
+            }
+        }
+
+        template <size_t Worker> void passReadyProduct(IRandomDevice &randomDevice)
+        {
+            if (_workerReadyProducts[Worker] != NoProduct)
+            {
+                passProduct<RampsCount + Worker>(_workerReadyProducts[Worker], randomDevice);
+                _workerReadyProducts[Worker] = NoProduct;
+            }
+        }
+
+        template <size_t Worker> void processWorker()
+        {
+            constexpr auto &data = Structure.workers[WorkerOrder[Worker]];
+            constexpr bool fifo = data.type == WorkerType::FIFO;
+            auto &currentProduct = _workerCurrentProducts[Worker];
+            auto &queue = _queues[Worker];
+            if (currentProduct == NoProduct)
+            {
+                if (queue.size == 0)
+                {
+                    return;
+                }
+                currentProduct = popProduct<fifo>(queue);
+                _workerCounters[Worker] = 0;
+            }
+            if (++_workerCounters[Worker] >= data.processingTime)
+            {
+                _workerReadyProducts[Worker] = currentProduct;
+                currentProduct = queue.size > 0 ? popProduct<fifo>(queue) : NoProduct;
+                _workerCounters[Worker] = 0;
+            }
+        }
+
+        template <size_t Source> void passProduct(size_t product, IRandomDevice &randomDevice)
+        {
+            constexpr auto begin = Links.offsets[Source];
+            constexpr auto count = Links.offsets[Source + 1] - begin;
+            const auto probability = randomDevice.next();
+            if constexpr (count == 1)
+            {
+                pushProduct(Links.destinations[begin], product);
+            }
+            else
+            {
+                const auto scaled = probability * static_cast<double>(count);
+                auto link = std::min(static_cast<size_t>(scaled), count - 1);
+                pushProduct(scaled - static_cast<double>(link) < Links.aliasProbabilities[begin + link]
+                                ? Links.destinations[begin + link]
+                                : Links.aliases[begin + link],
+                            product);
+            }
+        }
+
+        void pushProduct(size_t destination, size_t product)
+        {
+            if (destination >= WorkersCount)
+            {
+                auto store = destination - WorkersCount;
+                auto index = _storedProducts.size();
+                _storedProducts.push_back({product, NoProduct});
+                (_storeTails[store] == NoProduct ? _storeHeads[store] : _storedProducts[_storeTails[store]].next) =
+                    index;
+                _storeTails[store] = index;
+                return;
+            }
+            auto &queue = _queues[destination];
+            if (queue.size == QueueCapacity)
+            {
+                queue.spill.push_back(product);
+                return;
+            }
+            queue.products[wrap(queue.head + queue.size)] = product;
+            ++queue.size;
+        }
+
+        template <bool First> static size_t popProduct(Queue &queue)
+        {
+            if constexpr (First)
+            {
+                auto product = queue.products[queue.head];
+                queue.head = wrap(queue.head + 1);
+                if (queue.spill.empty())
+                {
+                    --queue.size;
+                }
+                else
+                {
+                    queue.products[wrap(queue.head + queue.size - 1)] = queue.spill.front();
+                    queue.spill.pop_front();
+                }
+                return product;
+            }
+            else
+            {
+                if (!queue.spill.empty())
+                {
+                    auto product = queue.spill.back();
+                    queue.spill.pop_back();
+                    return product;
+                }
+                --queue.size;
+                return queue.products[wrap(queue.head + queue.size)];
+            }
+        }
+
+        static size_t wrap(size_t index)
+        {
+            return index >= QueueCapacity ? index - QueueCapacity : index;
+        }
+
+        static void appendQueue(std::string &out, const Queue &queue)
+        {
+            for (size_t index = 0; index < queue.size + queue.spill.size(); ++index)
+            {
+                if (index > 0)
+                {
+                    out += ", ";
+                }
+                auto product =
+                    index < queue.size ? queue.products[wrap(queue.head + index)] : queue.spill[index - queue.size];
+                std::format_to(std::back_inserter(out), "#{}", product);
+            }
+        }
+
+        void appendStoredProducts(std::string &out, size_t store) const
+        {
+            for (auto index = _storeHeads[store]; index != NoProduct; index = _storedProducts[index].next)
+            {
+                if (index != _storeHeads[store])
+                {
+                    out += ", ";
+                }
+                std::format_to(std::back_inserter(out), "#{}", _storedProducts[index].product);
+            }
+        }
+
+        static constexpr size_t getDestinationIndex(const LinkBind &bind)
+        {
+            if (bind.type == NodeType::WORKER)
+            {
+                for (size_t worker = 0; worker < WorkersCount; ++worker)
+                {
+                    if (Structure.workers[WorkerOrder[worker]].id == bind.id)
+                    {
+                        return worker;
+                    }
+                }
+            }
+            for (size_t store = 0; store < StoreHousesCount; ++store)
+            {
+                if (Structure.storeHouses[StoreOrder[store]].id == bind.id)
+                {
+                    return WorkersCount + store;
+                }
+            }
+            return NoProduct;
+        }
+
+        // Mirrors SourceNode::normalize and its AliasTable, so sampling consumes the random device identically
+        static constexpr SourceLinks createSourceLinks()
+        {
+            SourceLinks table;
+            size_t next = 0;
+            for (size_t source = 0; source < RampsCount + WorkersCount; ++source)
+            {
+                table.offsets[source] = next;
+                const LinkBind bind = source < RampsCount
+                                          ? LinkBind{Structure.loadingRamps[RampOrder[source]].id, NodeType::RAMP}
+                                          : LinkBind{Structure.workers[WorkerOrder[source - RampsCount]].id,
+                                                     NodeType::WORKER};
+
+                std::vector<double> weights;
+                double totalBase = 0;
+                for (auto &link : Structure.links)
+                {
+                    if (link.source.id == bind.id && link.source.type == bind.type)
+                    {
+                        table.destinations[next + weights.size()] = getDestinationIndex(link.destination);
+                        weights.push_back(std::clamp(link.probability, .0, 1.0));
+                        totalBase += weights.back();
+                    }
+                }
+                for (auto &weight : weights)
+                {
+                    weight = weight / totalBase;
+                }
+
+                const AliasTable aliasTable{weights};
+                for (size_t index = 0; index < weights.size(); ++index)
+                {
+                    table.aliasProbabilities[next + index] = aliasTable.getProbabilities()[index];
+                    table.aliases[next + index] = table.destinations[next + aliasTable.getAliases()[index]];
+                }
+                next += weights.size();
+            }
+            table.offsets[RampsCount + WorkersCount] = next;
+            return table;
+        }
+
+        static constexpr SourceLinks Links = createSourceLinks();
+    };
+} // namespace sd
\ No newline at end of file
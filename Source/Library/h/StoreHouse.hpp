@@ -1,7 +1,5 @@
 #pragma once
 
-#include <deque>
-
 #include "Node.hpp"
 #include "Product.hpp"
 
@@ -10,6 +8,7 @@ namespace sd
     struct StoreHouseData
     {
         size_t id;
+        size_t capacity = 0;
     };
 
     class StoreHouse final : public DestinationNode
@@ -17,15 +16,15 @@ namespace sd
       public:
         using Ptr = std::unique_ptr<StoreHouse>;
 
-        StoreHouse(size_t id);
+        StoreHouse(size_t id, size_t capacity = 0);
 
         StoreHouse(const StoreHouseData &data);
 
         const StoreHouseData getStoreHouseData() const;
 
-        std::string getStructureRaport(size_t offset) const final;
+        void writeStructureRaport(IRaportSink &sink, size_t offset) const final;
 
-        std::string getStateRaport(size_t offset) const final;
+        void writeStateRaport(IRaportSink &sink, size_t offset) const final;
 
         std::string toString() const final;
 
@@ -0,0 +1,28 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+
+#include "Factory.hpp"
+#include "FactoryStructure.hpp"
+
+namespace sd
+{
+    class StructureFile
+    {
+      public:
+        static constexpr std::array<char, 4> Magic = {'S', 'D', 'F', 'S'};
+        static constexpr uint8_t Version = 1;
+        static constexpr std::string_view BinaryExtension = ".sdfs";
+
+        static void save(const Factory &factory, const std::filesystem::path &path);
+        static void load(Factory &factory, const std::filesystem::path &path);
+
+        static bool isBinary(const std::filesystem::path &path);
+
+        static void write(std::ostream &out, const FactoryStructure &structure);
+        static FactoryStructure read(std::istream &in);
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+#include <filesystem>
+#include <string_view>
+#include <vector>
+
+#include "Factory.hpp"
+#include "ThreadPool.hpp"
+
+namespace sd
+{
+    class StructureParser
+    {
+      private:
+        static constexpr size_t MinChunkSize = size_t{1} << 20;
+
+        struct Chunk;
+
+        Factory &_factory;
+        size_t _threads;
+
+      public:
+        StructureParser(Factory &factory, size_t threads = ThreadPool::getDefaultThreadsCount());
+
+        void parse(std::string_view text);
+        void parseFile(const std::filesystem::path &path);
+
+      private:
+        std::vector<Chunk> parseChunks(std::string_view text) const;
+        void addChunks(const std::vector<Chunk> &chunks);
+    };
+} // namespace sd
\ No newline at end of file
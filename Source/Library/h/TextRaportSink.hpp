@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+
+#include "Interfaces.hpp"
+
+namespace sd
+{
+    class TextRaportSink final : public IRaportSink
+    {
+      private:
+        std::string &_out;
+        bool _separate = false;
+
+      public:
+        TextRaportSink(std::string &out);
+
+        void beginRaport(size_t time, bool delta) final;
+        void beginSection(std::string_view title) final;
+        void beginNode(size_t offset, NodeType type, size_t id) final;
+        void writeProperty(size_t offset, std::string_view name, size_t value) final;
+        void writeProperty(size_t offset, std::string_view name, std::string_view value) final;
+        void beginLinks(size_t offset) final;
+        void writeLink(size_t offset, NodeType type, size_t id, double probability) final;
+        void beginQueue(size_t offset) final;
+        void writeCurrentProduct(uint64_t id, size_t processingTime) final;
+        void writeProduct(uint64_t id) final;
+        void writeQueueSummary(size_t offset, const QueueSummary &summary, size_t listedProducts) final;
+        void endNode() final;
+        void beginLatencyRaport() final;
+        void writeLatency(size_t offset, std::string_view name, const LatencyStatistic &statistic) final;
+
+        static std::string_view getNodeName(NodeType type);
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <barrier>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace sd
+{
+    class ThreadPool
+    {
+      private:
+        std::function<void(size_t)> _task;
+        std::vector<std::exception_ptr> _errors;
+        std::barrier<> _startBarrier;
+        std::barrier<> _endBarrier;
+        bool _stopping = false;
+        std::vector<std::thread> _threads;
+
+      public:
+        ThreadPool(size_t threadsCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        size_t getThreadsCount() const;
+
+        void run(std::function<void(size_t)> task);
+
+        static size_t getDefaultThreadsCount();
+
+      private:
+        void work(size_t thread);
+        void execute(size_t thread);
+    };
+} // namespace sd
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "EventTrace.hpp"
+
+namespace sd
+{
+    class TraceReader
+    {
+      private:
+        std::vector<uint8_t> _data;
+        size_t _offset = 0;
+        size_t _startTime = 0;
+        size_t _time = 0;
+
+      public:
+        TraceReader(const std::filesystem::path &path);
+        TraceReader(std::vector<uint8_t> data);
+
+        size_t getStartTime() const;
+
+        std::optional<EventTrace::Event> next();
+
+        std::vector<EventTrace::Event> readAll();
+
+      private:
+        uint64_t readVarint();
+        void readHeader();
+    };
+} // namespace sd
\ No newline at end of file
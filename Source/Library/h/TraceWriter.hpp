@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace sd
+{
+    class TraceWriter
+    {
+      private:
+        static constexpr size_t MappingChunk = size_t{64} << 20;
+
+        std::filesystem::path _path;
+#ifdef _WIN32
+        void *_file = nullptr;
+        void *_mapping = nullptr;
+#else
+        int _file = -1;
+#endif
+        uint8_t *_data = nullptr;
+        size_t _size = 0;
+        size_t _capacity = 0;
+
+      public:
+        TraceWriter(const std::filesystem::path &path);
+        TraceWriter(const TraceWriter &) = delete;
+        TraceWriter &operator=(const TraceWriter &) = delete;
+        ~TraceWriter();
+
+        void append(const uint8_t *data, size_t size);
+
+        uint8_t *prepare(size_t size)
+        {
+            if (_size + size > _capacity)
+            {
+                reserve(_size + size);
+            }
+            return _data + _size;
+        }
+
+        void commit(const uint8_t *end)
+        {
+            _size = end - _data;
+        }
+
+        size_t getSize() const;
+
+        void close();
+
+      private:
+        void reserve(size_t size);
+        void map(size_t capacity);
+        void unmap();
+    };
+} // namespace sd
\ No newline at end of file
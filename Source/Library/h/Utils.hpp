@@ -22,6 +22,21 @@ namespace sd
         FIFO
     };
 
+    enum SimulationEngine
+    {
+        TICK,
+        EVENT,
+        PARALLEL,
+        FLAT
+    };
+
+    enum RaportMode
+    {
+        FULL,
+        DELTA,
+        SUMMARY
+    };
+
     std::vector<std::string> splitStr(const std::string &str, char splitChar);
 
     std::ostream &operator<<(std::ostream &stream, const Factory &factory);
@@ -13,10 +13,13 @@ namespace sd
         size_t id;
         size_t processingTime;
         WorkerType type;
+        size_t capacity = 0;
     };
 
-    class Worker final : public SourceNode, public DestinationNode, public Processable
+    class Worker final : public SourceNode, public DestinationNode, public Processable<Worker>
     {
+        friend class Processable<Worker>;
+
       private:
         WorkerType _type;
         Product::Ptr _currentProduct;
@@ -24,30 +27,43 @@ namespace sd
       public:
         using Ptr = std::unique_ptr<Worker>;
 
-        Worker(size_t id, WorkerType type = WorkerType::FIFO, size_t processingTime = 1);
+        Worker(size_t id, WorkerType type = WorkerType::FIFO, size_t processingTime = 1, size_t capacity = 0);
 
         Worker(const WorkerData &data);
 
         const WorkerData getWorkerData() const;
 
-        void process(const size_t currentTime) final;
+        void process(const size_t currentTime);
+
+        DestinationNode *passProduct()
+        {
+            return SourceNode::passProduct(getNodeState());
+        }
+
+        void skip(const size_t ticks);
 
-        std::string getStructureRaport(size_t offset) const final;
+        void writeStructureRaport(IRaportSink &sink, size_t offset) const final;
 
-        std::string getStateRaport(size_t offset) const final;
+        void writeStateRaport(IRaportSink &sink, size_t offset) const final;
 
         std::string toString() const final;
 
         NodeType getNodeType() const final;
 
-        bool isProcessingProduct() const;
+        bool isProcessingProduct() const
+        {
+            return bool{_currentProduct};
+        }
+        const Product *getCurrentProduct() const;
+        void restoreService(Product::Ptr &&product, size_t processedTime);
 
-      protected:
-        void triggerOperation() final;
+        void saveCheckpoint(BinaryWriter &writer, bool latency) const;
+        void loadCheckpoint(BinaryReader &reader);
 
       private:
-        WorkerType getWorkerType() const;
+        void triggerOperation();
+        void startService();
 
-        std::string getCurrentWorkRaport() const;
+        WorkerType getWorkerType() const;
     };
 } // namespace sd
\ No newline at end of file
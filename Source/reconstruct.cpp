@@ -0,0 +1,48 @@
+#include <fstream>
+#include <iostream>
+
+#include "CLI11.hpp"
+#include "RaportReconstructor.hpp"
+
+int main(int argc, char **argv)
+{
+    auto &out = std::cout;
+    auto &err = std::cerr;
+    try
+    {
+        std::string inputFile;
+        std::optional<std::string> outputFile;
+
+        CLI::App app{"Rebuilds full state raports from delta raport file"};
+        app.add_option("-i,--input", inputFile, "File with delta raports")->check(CLI::ExistingFile)->required();
+        app.add_option("-o,--output", outputFile, "Full raports will be saved in this file");
+        try
+        {
+            app.parse(argc, argv);
+        }
+        catch (const CLI::ParseError &e)
+        {
+            return app.exit(e, out, err);
+        }
+
+        std::ifstream input(inputFile);
+        if (outputFile)
+        {
+            std::ofstream output(*outputFile);
+            sd::RaportReconstructor{input, output}.run();
+        }
+        else
+        {
+            sd::RaportReconstructor{input, out}.run();
+        }
+    }
+    catch (std::exception &e)
+    {
+        out << e.what();
+    }
+    catch (...)
+    {
+        out << "Unexpected error occured";
+    }
+    return 0;
+}
\ No newline at end of file
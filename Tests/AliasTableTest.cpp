@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <numeric>
+
+
+#include "AliasTable.hpp"
+
+class AliasTableTest : public ::testing::Test
+{
+  protected:
+    AliasTableTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    std::vector<double> sampleFrequencies(const sd::AliasTable &table, size_t samples)
+    {
+        std::vector<double> frequencies(table.size());
+        for (size_t sample = 0; sample < samples; ++sample)
+        {
+            auto propability = (static_cast<double>(sample) + 0.5) / static_cast<double>(samples);
+            frequencies[table.sample(propability)] += 1.0 / static_cast<double>(samples);
+        }
+        return frequencies;
+    }
+
+    ~AliasTableTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(AliasTableTest, SingleLinkTest)
+{
+    sd::AliasTable table{{0.3}};
+
+    EXPECT_EQ(table.size(), 1);
+    EXPECT_EQ(table.sample(0), 0);
+    EXPECT_EQ(table.sample(0.5), 0);
+    EXPECT_EQ(table.sample(1), 0);
+}
+
+TEST_F(AliasTableTest, EmptyTableTest)
+{
+    sd::AliasTable table{std::vector<double>{}};
+
+    EXPECT_TRUE(table.empty());
+}
+
+TEST_F(AliasTableTest, SameDistributionAsCumulativeScanTest)
+{
+    std::vector<double> weights = {0.1, 0.25, 0.05, 0.3, 0.2, 0.1};
+    sd::AliasTable table{weights};
+
+    auto frequencies = sampleFrequencies(table, 600000);
+    for (size_t index = 0; index < weights.size(); ++index)
+    {
+        EXPECT_NEAR(frequencies[index], weights[index], 1e-5);
+    }
+}
+
+TEST_F(AliasTableTest, UnnormalizedWeightsTest)
+{
+    std::vector<double> weights = {1, 3, 4};
+    sd::AliasTable table{weights};
+
+    auto frequencies = sampleFrequencies(table, 300000);
+    EXPECT_NEAR(frequencies[0], 0.125, 1e-5);
+    EXPECT_NEAR(frequencies[1], 0.375, 1e-5);
+    EXPECT_NEAR(frequencies[2], 0.5, 1e-5);
+}
+
+TEST_F(AliasTableTest, ManyLinksTest)
+{
+    std::vector<double> weights(300);
+    std::iota(weights.begin(), weights.end(), 1.0);
+    sd::AliasTable table{weights};
+    auto total = std::accumulate(weights.begin(), weights.end(), 0.0);
+
+    auto frequencies = sampleFrequencies(table, 3000000);
+    for (size_t index = 0; index < weights.size(); ++index)
+    {
+        EXPECT_NEAR(frequencies[index], weights[index] / total, 1e-5);
+    }
+}
+
+TEST_F(AliasTableTest, InvalidWeightsTest)
+{
+    EXPECT_THROW(
+        try { sd::AliasTable({0, 0}); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Alias table requires positive total weight", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
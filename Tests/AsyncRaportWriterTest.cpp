@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "AsyncRaportWriter.hpp"
+#include "Factory.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+#include "TextRaportSink.hpp"
+
+class AsyncRaportWriterTest : public ::testing::Test
+{
+  protected:
+    AsyncRaportWriterTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~AsyncRaportWriterTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    struct FailingBuffer : std::streambuf
+    {
+    };
+
+    sd::RunOptions withPendingRaports(sd::RunOptions options, size_t pendingRaports)
+    {
+        options.pendingRaports = pendingRaports;
+        return options;
+    }
+} // namespace
+
+TEST_F(AsyncRaportWriterTest, SnapshotMatchesStateRaportTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillSlowFactory(factory);
+    std::stringstream out;
+    factory.run(700, out, {size_t{1000}}, withPendingRaports({}, 0));
+
+    sd::RaportSnapshot snapshot;
+    factory.captureStateSnapshot(snapshot, 699);
+    std::string formatted;
+    sd::TextRaportSink sink{formatted};
+    snapshot.replay(sink);
+
+    EXPECT_EQ(formatted, "========= Iteration: 699 =========\n" + factory.generateStateRaport());
+}
+
+TEST_F(AsyncRaportWriterTest, SameRaportsAsSynchronousTest)
+{
+    for (auto engine : {sd::SimulationEngine::TICK, sd::SimulationEngine::EVENT, sd::SimulationEngine::PARALLEL})
+    {
+        sd::RunOptions options{engine, 2};
+        auto expected = runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}}, withPendingRaports(options, 0));
+        auto single = runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}}, withPendingRaports(options, 1));
+        auto pending = runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}}, options);
+        auto bounded = runRepetableSimulation(&fillBoundedFactory, 600, {size_t{3}}, options);
+
+        EXPECT_EQ(single, expected);
+        EXPECT_EQ(pending, expected);
+        EXPECT_EQ(bounded,
+                  runRepetableSimulation(&fillBoundedFactory, 600, {size_t{3}}, withPendingRaports(options, 0)));
+    }
+}
+
+TEST_F(AsyncRaportWriterTest, WritesSnapshotsInOrderTest)
+{
+    std::stringstream out;
+    sd::AsyncRaportWriter writer{out, 2};
+    std::string expected;
+    for (size_t time = 0; time < 50; ++time)
+    {
+        auto snapshot = writer.acquire();
+        EXPECT_TRUE(snapshot.workers.empty());
+        snapshot.time = time;
+        snapshot.products = {time, time + 1};
+        snapshot.storeHouses.push_back({1, 2});
+        expected += std::format("========= Iteration: {} =========\n== WORKERS ==\n\n== STOREHOUSES ==\n\n"
+                                "STOREHOUSE #1\n\tQueue: #{}, #{}\n\n",
+                                time, time, time + 1);
+        writer.submit(std::move(snapshot));
+    }
+    writer.flush();
+
+    EXPECT_EQ(out.str(), expected);
+}
+
+TEST_F(AsyncRaportWriterTest, WriteErrorTest)
+{
+    FailingBuffer buffer;
+    std::ostream out{&buffer};
+    out.exceptions(std::ios::badbit);
+    sd::AsyncRaportWriter writer{out, 1};
+
+    writer.submit(writer.acquire());
+
+    EXPECT_THROW(writer.flush(), std::ios::failure);
+    EXPECT_THROW(writer.submit(writer.acquire()), std::ios::failure);
+}
+
+TEST_F(AsyncRaportWriterTest, ZeroCapacityTest)
+{
+    std::stringstream out;
+
+    EXPECT_THROW(
+        try { sd::AsyncRaportWriter(out, 0); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Raport writer capacity must be positive", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
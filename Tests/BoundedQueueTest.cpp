@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "FlatFactory.hpp"
+#include "Random.hpp"
+#include "RingBuffer.hpp"
+#include "TestHelpers.hpp"
+
+class BoundedQueueTest : public ::testing::Test
+{
+  protected:
+    BoundedQueueTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~BoundedQueueTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(BoundedQueueTest, RingBufferTest)
+{
+    sd::RingBuffer<int> buffer{3};
+
+    buffer.push_back(1);
+    buffer.push_back(2);
+    buffer.push_back(3);
+
+    EXPECT_TRUE(buffer.full());
+    EXPECT_EQ(buffer.pop_front(), 1);
+
+    buffer.push_back(4);
+
+    EXPECT_EQ(buffer[0], 2);
+    EXPECT_EQ(buffer[2], 4);
+    EXPECT_EQ(buffer.pop_back(), 4);
+    EXPECT_EQ(buffer.pop_front(), 2);
+    EXPECT_EQ(buffer.pop_front(), 3);
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_THROW(buffer.pop_back(), std::runtime_error);
+}
+
+TEST_F(BoundedQueueTest, UnboundedRingBufferTest)
+{
+    sd::RingBuffer<size_t> buffer;
+
+    for (size_t value = 0; value < 100; ++value)
+    {
+        buffer.push_back(size_t{value});
+    }
+
+    EXPECT_FALSE(buffer.full());
+    EXPECT_EQ(buffer.size(), 100);
+    for (size_t value = 0; value < 100; ++value)
+    {
+        EXPECT_EQ(buffer.pop_front(), value);
+    }
+}
+
+TEST_F(BoundedQueueTest, FullDestinationTest)
+{
+    auto worker = std::make_unique<sd::Worker>(1, sd::WorkerType::FIFO, 3, 1);
+
+    worker->addProductToStore(std::make_unique<sd::Product>());
+
+    EXPECT_TRUE(worker->isFull());
+    EXPECT_THROW(
+        try { worker->addProductToStore(std::make_unique<sd::Product>()); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Queue of WORKER #1 is full", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(BoundedQueueTest, BlockedSourceKeepsProductTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    factory.addLoadingRamp({1, 1});
+    factory.addWorker({1, 5, sd::WorkerType::FIFO, 1});
+    factory.addStorehouse({1});
+    factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+
+    std::stringstream out;
+    factory.run(3, out, {size_t{0}});
+
+    auto raport = factory.generateStateRaport();
+    EXPECT_NE(raport.find("WORKER #1\n\tQueue: #0 (pt = 3), #1\n"), std::string::npos);
+    EXPECT_EQ(sd::Product::getIdSeed(), 3);
+    EXPECT_TRUE(cmp(factory.getWorkersData(), {{1, 5, sd::WorkerType::FIFO, 1}}));
+}
+
+TEST_F(BoundedQueueTest, SameRaportsAcrossEnginesTest)
+{
+    auto expected = runRepetableSimulation(&fillBoundedFactory, 600, {size_t{11}}, {sd::SimulationEngine::TICK});
+    auto events = runRepetableSimulation(&fillBoundedFactory, 600, {size_t{11}}, {sd::SimulationEngine::EVENT});
+    auto parallel =
+        runRepetableSimulation(&fillBoundedFactory, 600, {size_t{11}}, {sd::SimulationEngine::PARALLEL, 3});
+
+    EXPECT_EQ(events, expected);
+    EXPECT_EQ(parallel, expected);
+}
+
+TEST_F(BoundedQueueTest, StoreHouseFillsUpTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillBoundedFactory(factory);
+
+    std::stringstream out;
+    factory.run(5000, out, {size_t{0}}, {sd::SimulationEngine::EVENT});
+
+    auto raport = factory.generateStateRaport();
+    auto store = raport.substr(raport.find("STOREHOUSE #2"));
+    EXPECT_EQ(std::count(store.begin(), store.end(), '#'), 41);
+}
+
+TEST_F(BoundedQueueTest, ReadCapacityTest)
+{
+    std::stringstream in{"WORKER id=1 processing-time=2 queue-type=FIFO capacity=3\nSTOREHOUSE id=1 capacity=7\n"};
+    sd::Factory factory;
+    in >> factory;
+
+    EXPECT_TRUE(cmp(factory.getWorkersData(), {{1, 2, sd::WorkerType::FIFO, 3}}));
+    EXPECT_TRUE(cmp(factory.getStorehousesData(), {{1, 7}}));
+
+    std::stringstream out;
+    out << factory;
+    EXPECT_NE(out.str().find("WORKER id=1 processing-time=2 queue-type=FIFO capacity=3\n"), std::string::npos);
+    EXPECT_NE(out.str().find("STOREHOUSE id=1 capacity=7\n"), std::string::npos);
+}
+
+TEST_F(BoundedQueueTest, ReadInvalidCapacityTest)
+{
+    std::stringstream in{"STOREHOUSE id=1 capacity=0\n"};
+    sd::Factory factory;
+
+    EXPECT_THROW(
+        try { in >> factory; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Error in line 0: Sentence: \"capacity=0\", expected to fit this pattern: "
+                         "capacity=<capacity>, where <capacity> is number grather than zero",
+                         e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(BoundedQueueTest, FlatEngineNotSupportedTest)
+{
+    sd::Factory factory;
+    fillBoundedFactory(factory);
+
+    EXPECT_THROW(
+        try { sd::FlatFactory{factory}; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Factory with bounded queues cannot be compiled.", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,393 @@
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class CheckpointTest : public ::testing::Test
+{
+  protected:
+    CheckpointTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(checkpointFile);
+        std::filesystem::remove(checkpointFile + ".stores");
+    }
+
+    std::string runInterrupted(void (*fill)(sd::Factory &), size_t maxIterations, size_t interruptTime,
+                               const sd::Factory::RaportGuard &guard, sd::RunOptions options)
+    {
+        resetRepetableSimulation();
+        options.checkpointFile = checkpointFile;
+
+        sd::Factory interrupted;
+        fill(interrupted);
+        std::stringstream interruptedOut;
+        interrupted.run(interruptTime, interruptedOut, guard, options);
+
+        sd::Random::get().updateRandomDevice(std::make_unique<RepetableRandomDevice>());
+        sd::Product::setIdSeed(12345);
+
+        sd::Factory resumed;
+        fill(resumed);
+        auto checkpoint = resumed.loadCheckpoint(std::filesystem::path{checkpointFile});
+
+        EXPECT_TRUE(checkpoint.raportOffset);
+        std::stringstream out;
+        out << interruptedOut.str().substr(0, *checkpoint.raportOffset);
+        options.startTime = checkpoint.time;
+        resumed.run(maxIterations, out, guard, options);
+        out << resumed.generateStateRaport();
+        return out.str();
+    }
+
+    std::string runUninterrupted(void (*fill)(sd::Factory &), size_t maxIterations,
+                                 const sd::Factory::RaportGuard &guard, const sd::RunOptions &options)
+    {
+        resetRepetableSimulation();
+
+        sd::Factory factory;
+        fill(factory);
+        std::stringstream out;
+        factory.run(maxIterations, out, guard, options);
+        out << factory.generateStateRaport();
+        return out.str();
+    }
+
+    std::string checkpointFile = "checkpoint.bin";
+
+    ~CheckpointTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(CheckpointTest, ResumeTickEngineTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::TICK};
+    options.checkpointInterval = 50;
+
+    auto expected = runUninterrupted(&fillExampleFactory, 400, {size_t{7}}, options);
+    auto actual = runInterrupted(&fillExampleFactory, 400, 237, {size_t{7}}, options);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CheckpointTest, ResumeEventEngineTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::EVENT};
+    options.checkpointInterval = 300;
+
+    auto expected = runUninterrupted(&fillSlowFactory, 2000, {size_t{97}}, {sd::SimulationEngine::TICK});
+    auto actual = runInterrupted(&fillSlowFactory, 2000, 1000, {size_t{97}}, options);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CheckpointTest, ResumeParallelEngineTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::PARALLEL, 2};
+    options.checkpointInterval = 64;
+
+    auto expected = runUninterrupted(&fillSlowFactory, 1000, {size_t{50}}, {sd::SimulationEngine::TICK});
+    auto actual = runInterrupted(&fillSlowFactory, 1000, 700, {size_t{50}}, options);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CheckpointTest, ResumeBoundedFactoryTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::EVENT};
+    options.checkpointInterval = 50;
+
+    auto expected = runUninterrupted(&fillBoundedFactory, 800, {size_t{31}}, {sd::SimulationEngine::TICK});
+    auto actual = runInterrupted(&fillBoundedFactory, 800, 333, {size_t{31}}, options);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CheckpointTest, ResumeSummaryRaportTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::EVENT};
+    options.checkpointInterval = 100;
+    options.raportMode = sd::RaportMode::SUMMARY;
+
+    auto expected = runUninterrupted(&fillSlowFactory, 1500, {size_t{61}}, options);
+    auto actual = runInterrupted(&fillSlowFactory, 1500, 777, {size_t{61}}, options);
+
+    EXPECT_NE(expected.find("Queue age: p50 = "), std::string::npos);
+    EXPECT_EQ(actual, expected);
+}
+
+namespace
+{
+    void fillSplitFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 1});
+        factory.addWorker({1, 1, sd::WorkerType::FIFO});
+        factory.addWorker({2, 30, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addStorehouse({2});
+        factory.addLink({1, 0.5, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 0.5, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+        factory.addLink({3, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+        factory.addLink({4, 1, {2, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}});
+    }
+} // namespace
+
+TEST_F(CheckpointTest, ResumeDeltaRaportTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::TICK};
+    options.checkpointInterval = 100;
+    options.raportMode = sd::RaportMode::DELTA;
+    options.keyframeInterval = 7;
+
+    auto expected = runUninterrupted(&fillSlowFactory, 1500, {size_t{30}}, options);
+    auto actual = runInterrupted(&fillSlowFactory, 1500, 777, {size_t{30}}, options);
+
+    EXPECT_NE(expected.find("========= Iteration: 720 (delta) ========="), std::string::npos);
+    EXPECT_EQ(actual, expected);
+
+    // storehouse 2 stays unchanged between raports, so the resumed delta raports must keep leaving it out
+    options.checkpointInterval = 10;
+    options.keyframeInterval = 0;
+    expected = runUninterrupted(&fillSplitFactory, 40, {size_t{10}}, options);
+    actual = runInterrupted(&fillSplitFactory, 40, 25, {size_t{10}}, options);
+
+    auto resumedDelta = expected.find("========= Iteration: 20 (delta) =========");
+    ASSERT_NE(resumedDelta, std::string::npos);
+    EXPECT_EQ(expected.find("STOREHOUSE #2", resumedDelta), expected.rfind("STOREHOUSE #2"));
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CheckpointTest, ResumeRaportTimesTest)
+{
+    std::vector<size_t> times = {3, 40, 99, 100, 101, 180, 299};
+    sd::RunOptions options{sd::SimulationEngine::TICK};
+    options.checkpointInterval = 100;
+
+    auto expected = runUninterrupted(&fillExampleFactory, 300, {times}, options);
+    auto actual = runInterrupted(&fillExampleFactory, 300, 150, {times}, options);
+
+    EXPECT_EQ(actual, expected);
+}
+
+namespace
+{
+    void fillLatencyChainFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 1});
+        factory.addWorker({1, 2, sd::WorkerType::FIFO});
+        factory.addWorker({2, 3, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+        factory.addLink({3, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    }
+} // namespace
+
+TEST_F(CheckpointTest, ResumeLatencyRaportTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::EVENT};
+    options.checkpointInterval = 100;
+    options.trackLatency = true;
+
+    auto expected = runUninterrupted(&fillSlowFactory, 1000, {size_t{97}}, options);
+    auto actual = runInterrupted(&fillSlowFactory, 1000, 555, {size_t{97}}, options);
+
+    EXPECT_NE(expected.find("========= Latency Raport ========="), std::string::npos);
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(CheckpointTest, ResumeLatencyTrackingTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::TICK};
+    options.trackLatency = true;
+
+    resetRepetableSimulation();
+    sd::Factory uninterrupted;
+    fillLatencyChainFactory(uninterrupted);
+    std::stringstream out;
+    uninterrupted.run(300, out, {size_t{1000}}, options);
+
+    options.checkpointFile = checkpointFile;
+    options.checkpointInterval = 50;
+    resetRepetableSimulation();
+    sd::Factory interrupted;
+    fillLatencyChainFactory(interrupted);
+    interrupted.run(75, out, {size_t{1000}}, options);
+
+    sd::Factory resumed;
+    fillLatencyChainFactory(resumed);
+    options.startTime = resumed.loadCheckpoint(std::filesystem::path{checkpointFile}).time;
+    resumed.run(300, out, {size_t{1000}}, options);
+
+    EXPECT_EQ(options.startTime, 50);
+    std::stringstream expected;
+    uninterrupted.saveCheckpoint(expected, {300, std::nullopt});
+    std::stringstream actual;
+    resumed.saveCheckpoint(actual, {300, std::nullopt});
+    EXPECT_EQ(actual.str(), expected.str());
+}
+
+TEST_F(CheckpointTest, JournalTruncatedByResumedRunTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::TICK};
+    options.checkpointFile = checkpointFile;
+    options.checkpointInterval = 50;
+
+    resetRepetableSimulation();
+    sd::Factory interrupted;
+    fillLatencyChainFactory(interrupted);
+    std::stringstream out;
+    interrupted.run(75, out, {size_t{1000}}, options);
+    auto journalSize = std::filesystem::file_size(checkpointFile + ".stores");
+    {
+        std::ofstream journal(checkpointFile + ".stores", std::ios::binary | std::ios::app);
+        journal << "records written after the last checkpoint";
+    }
+
+    sd::Factory resumed;
+    fillLatencyChainFactory(resumed);
+    options.startTime = resumed.loadCheckpoint(std::filesystem::path{checkpointFile}).time;
+    EXPECT_GT(std::filesystem::file_size(checkpointFile + ".stores"), journalSize);
+
+    resumed.run(75, out, {size_t{1000}}, options);
+    EXPECT_EQ(std::filesystem::file_size(checkpointFile + ".stores"), journalSize);
+}
+
+TEST_F(CheckpointTest, LatencyEnabledOnResumeTest)
+{
+    sd::RunOptions options{sd::SimulationEngine::TICK};
+    options.checkpointFile = checkpointFile;
+    options.checkpointInterval = 50;
+
+    resetRepetableSimulation();
+    sd::Factory interrupted;
+    fillLatencyChainFactory(interrupted);
+    std::stringstream out;
+    interrupted.run(75, out, {size_t{1000}}, options);
+    auto journalSize = std::filesystem::file_size(checkpointFile + ".stores");
+
+    sd::Factory resumed;
+    fillLatencyChainFactory(resumed);
+    options.startTime = resumed.loadCheckpoint(std::filesystem::path{checkpointFile}).time;
+    options.trackLatency = true;
+    resumed.run(175, out, {size_t{1000}}, options);
+
+    EXPECT_GT(std::filesystem::file_size(checkpointFile + ".stores"), journalSize);
+    sd::Factory reloaded;
+    fillLatencyChainFactory(reloaded);
+    options.startTime = reloaded.loadCheckpoint(std::filesystem::path{checkpointFile}).time;
+    options.checkpointFile = std::nullopt;
+    options.checkpointInterval = 0;
+    reloaded.run(175, out, {size_t{1000}}, options);
+
+    EXPECT_EQ(options.startTime, 150);
+    EXPECT_EQ(reloaded.generateStateRaport(), resumed.generateStateRaport());
+}
+
+TEST_F(CheckpointTest, SaveLoadStateTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream out;
+    factory.run(120, out, {size_t{0}});
+
+    std::stringstream checkpoint;
+    factory.saveCheckpoint(checkpoint, {120, std::nullopt});
+    auto idSeed = sd::Product::getIdSeed();
+    auto nextRandom = sd::Random::get().next();
+
+    sd::Product::setIdSeed(0);
+    sd::Factory loaded;
+    fillExampleFactory(loaded);
+    auto info = loaded.loadCheckpoint(checkpoint);
+
+    EXPECT_EQ(info.time, 120);
+    EXPECT_EQ(info.raportOffset, std::nullopt);
+    EXPECT_EQ(loaded.generateStateRaport(), factory.generateStateRaport());
+    EXPECT_EQ(sd::Product::getIdSeed(), idSeed);
+    EXPECT_EQ(sd::Random::get().next(), nextRandom);
+}
+
+TEST_F(CheckpointTest, StructureMismatchTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream checkpoint;
+    factory.saveCheckpoint(checkpoint, {0, std::nullopt});
+
+    sd::Factory other;
+    fillSlowFactory(other);
+
+    EXPECT_THROW(
+        try { other.loadCheckpoint(checkpoint); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Checkpoint LoadingRamp count does not match factory structure", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(CheckpointTest, InvalidCheckpointTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream checkpoint{"not a checkpoint"};
+
+    EXPECT_THROW(
+        try { factory.loadCheckpoint(checkpoint); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Invalid checkpoint file", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(CheckpointTest, JournalRequiredTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream out;
+    sd::RunOptions options{sd::SimulationEngine::TICK};
+    options.checkpointFile = checkpointFile;
+    options.checkpointInterval = 10;
+    factory.run(30, out, {size_t{0}}, options);
+
+    std::ifstream file(checkpointFile, std::ios::binary);
+    EXPECT_THROW(
+        try { factory.loadCheckpoint(file); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Checkpoint with storehouse journal must be loaded from file", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(CheckpointTest, FlatEngineNotSupportedTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream out;
+    sd::RunOptions options{sd::SimulationEngine::FLAT};
+    options.checkpointFile = checkpointFile;
+    options.checkpointInterval = 10;
+
+    EXPECT_THROW(factory.run(100, out, {size_t{0}}, options), std::runtime_error);
+}
\ No newline at end of file
@@ -131,3 +131,58 @@ TEST_F(CommandParserTest, OptionsExcludedTest)
 
     EXPECT_EQ(str.str(), expected);
 }
+
+
+TEST_F(CommandParserTest, EngineOptionsTest)
+{
+    std::stringstream str;
+    std::filesystem::path filename = "existingFile.txt";
+
+    std::ofstream outfile(filename);
+    outfile.close();
+
+    EXPECT_TRUE(parse(std::format("Factory.exe -f {} -e Parallel -j 6", filename.string()), str, str));
+    std::filesystem::remove(filename);
+
+    EXPECT_TRUE(str.str().empty());
+
+    auto config = parser.getResults();
+    EXPECT_EQ(config.runOptions.engine, sd::SimulationEngine::PARALLEL);
+    EXPECT_EQ(config.runOptions.threads, 6);
+}
+
+TEST_F(CommandParserTest, CheckpointExcludesReplicasTest)
+{
+    std::stringstream str;
+    std::filesystem::path filename = "existingFile.txt";
+
+    std::ofstream outfile(filename);
+    outfile.close();
+
+    EXPECT_FALSE(parse(std::format("Factory.exe -f {} -n 4 -c ck -k 100", filename.string()), str, str));
+    std::filesystem::remove(filename);
+
+    EXPECT_EQ(str.str(), "--replicas excludes --checkpoint\nRun with --help for more information.\n");
+}
+
+TEST_F(CommandParserTest, ResumeExcludesTraceAndMetricsTest)
+{
+    std::stringstream trace;
+    std::stringstream metrics;
+    std::stringstream latency;
+    std::filesystem::path filename = "existingFile.txt";
+
+    std::ofstream outfile(filename);
+    outfile.close();
+
+    EXPECT_FALSE(parse(std::format("Factory.exe -f {} -c ck --resume --trace trace.bin", filename.string()), trace,
+                       trace));
+    EXPECT_FALSE(parse(std::format("Factory.exe -f {} -c ck --resume --metricsFile metrics.bin", filename.string()),
+                       metrics, metrics));
+    EXPECT_FALSE(parse(std::format("Factory.exe -f {} -c ck --resume --latency", filename.string()), latency, latency));
+    std::filesystem::remove(filename);
+
+    EXPECT_EQ(trace.str(), "--resume excludes --trace\nRun with --help for more information.\n");
+    EXPECT_EQ(metrics.str(), "--resume excludes --metricsFile\nRun with --help for more information.\n");
+    EXPECT_EQ(latency.str(), "--resume excludes --latency\nRun with --help for more information.\n");
+}
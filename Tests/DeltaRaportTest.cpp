@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "Random.hpp"
+#include "RaportReconstructor.hpp"
+#include "TestHelpers.hpp"
+
+class DeltaRaportTest : public ::testing::Test
+{
+  protected:
+    DeltaRaportTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~DeltaRaportTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    sd::RunOptions deltaOptions(sd::SimulationEngine engine, size_t keyframeInterval, size_t pendingRaports = 4)
+    {
+        sd::RunOptions options{engine, 2};
+        options.raportMode = sd::RaportMode::DELTA;
+        options.keyframeInterval = keyframeInterval;
+        options.pendingRaports = pendingRaports;
+        return options;
+    }
+
+    std::string reconstruct(const std::string &raport)
+    {
+        std::stringstream in{raport};
+        std::stringstream out;
+        sd::RaportReconstructor{in, out}.run();
+        return out.str();
+    }
+
+    size_t countOccurrences(const std::string &text, const std::string &pattern)
+    {
+        size_t count = 0;
+        for (auto position = text.find(pattern); position != std::string::npos;
+             position = text.find(pattern, position + 1))
+        {
+            ++count;
+        }
+        return count;
+    }
+} // namespace
+
+TEST_F(DeltaRaportTest, ReconstructMatchesFullRaportTest)
+{
+    for (auto engine : {sd::SimulationEngine::TICK, sd::SimulationEngine::EVENT, sd::SimulationEngine::PARALLEL})
+    {
+        auto full = runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}}, {engine, 2});
+        auto delta = runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}}, deltaOptions(engine, 5));
+        auto synchronous = runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}}, deltaOptions(engine, 5, 0));
+
+        EXPECT_EQ(synchronous, delta);
+        EXPECT_LT(delta.size(), full.size());
+        EXPECT_EQ(reconstruct(delta), full);
+    }
+}
+
+TEST_F(DeltaRaportTest, ReconstructBoundedFactoryTest)
+{
+    auto full = runRepetableSimulation(&fillBoundedFactory, 600, {std::vector<size_t>{0, 1, 2, 50, 51, 599}}, {});
+    auto delta = runRepetableSimulation(&fillBoundedFactory, 600, {std::vector<size_t>{0, 1, 2, 50, 51, 599}},
+                                        deltaOptions(sd::SimulationEngine::TICK, 0));
+
+    EXPECT_EQ(countOccurrences(delta, "(delta)"), 5);
+    EXPECT_EQ(reconstruct(delta), full);
+}
+
+TEST_F(DeltaRaportTest, KeyframeIntervalTest)
+{
+    auto delta = runRepetableSimulation(&fillExampleFactory, 100, {size_t{10}},
+                                        deltaOptions(sd::SimulationEngine::TICK, 4));
+
+    EXPECT_EQ(countOccurrences(delta, "========= Iteration: "), 10);
+    EXPECT_EQ(countOccurrences(delta, "(delta)"), 7);
+}
+
+TEST_F(DeltaRaportTest, OnlyChangedNodesTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    factory.addLoadingRamp({1, 1});
+    factory.addWorker({1, 1, sd::WorkerType::FIFO});
+    factory.addWorker({2, 1, sd::WorkerType::FIFO});
+    factory.addStorehouse({1});
+    factory.addStorehouse({2});
+    factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    factory.addLink({3, 1, {2, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}});
+
+    std::stringstream out;
+    factory.run(6, out, {std::vector<size_t>{4, 5}}, deltaOptions(sd::SimulationEngine::TICK, 0));
+
+    auto delta = out.str().substr(out.str().find("========= Iteration: 5 (delta) ========="));
+    EXPECT_EQ(delta, "========= Iteration: 5 (delta) =========\n== WORKERS ==\n\nWORKER #1\n\tQueue: \n\n"
+                     "== STOREHOUSES ==\n\nSTOREHOUSE #1\n\tQueue: #0, #1, #2, #3, #4\n\n");
+}
+
+TEST_F(DeltaRaportTest, MissingKeyframeTest)
+{
+    EXPECT_THROW(
+        try { reconstruct("========= Iteration: 3 (delta) =========\n== WORKERS ==\n\n== STOREHOUSES ==\n\n"); } catch (
+            const std::runtime_error &e) {
+            EXPECT_STREQ("Delta raport of iteration 3 has no preceding keyframe", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(DeltaRaportTest, FlatEngineNotSupportedTest)
+{
+    EXPECT_THROW(
+        try {
+            runRepetableSimulation(&fillExampleFactory, 10, {size_t{1}}, deltaOptions(sd::SimulationEngine::FLAT, 1));
+        } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Flat engine does not support delta raports", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+#include "DenseMap.hpp"
+
+class DenseMapTest : public ::testing::Test
+{
+  protected:
+    DenseMapTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~DenseMapTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    template <class Value> std::vector<size_t> getKeys(const sd::DenseMap<Value> &map)
+    {
+        std::vector<size_t> keys;
+        for (auto &[key, _] : map)
+        {
+            keys.push_back(key);
+        }
+        return keys;
+    }
+} // namespace
+
+TEST_F(DenseMapTest, IterateInKeyOrderTest)
+{
+    sd::DenseMap<std::string> map;
+    map.emplace(5, "five");
+    map.emplace(1, "one");
+    map.emplace(3, "three");
+    map.emplace(8, "eight");
+
+    EXPECT_EQ(getKeys(map), (std::vector<size_t>{1, 3, 5, 8}));
+    EXPECT_EQ(map.find(3)->second, "three");
+
+    map.emplace(2, "two");
+    EXPECT_EQ(getKeys(map), (std::vector<size_t>{1, 2, 3, 5, 8}));
+    EXPECT_EQ(map.find(8)->second, "eight");
+}
+
+TEST_F(DenseMapTest, SortedOnModificationTest)
+{
+    sd::DenseMap<int> map;
+    map.emplace(7, 70);
+    map.emplace(2, 20);
+    auto inserted = map.emplace(4, 40);
+
+    EXPECT_EQ(inserted.first, map.begin() + 1);
+    EXPECT_EQ(inserted.first->second, 40);
+    const auto &constMap = map;
+    EXPECT_EQ(constMap.begin()->first, 2);
+    EXPECT_EQ((constMap.end() - 1)->first, 7);
+
+    map.erase(map.find(2));
+    EXPECT_EQ(map.begin()->first, 4);
+    EXPECT_EQ(map.find(7)->second, 70);
+    EXPECT_EQ(map.find(4)->second, 40);
+}
+
+TEST_F(DenseMapTest, FindTest)
+{
+    sd::DenseMap<int> map;
+
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(1), map.end());
+    EXPECT_FALSE(map.contains(1));
+
+    map.emplace(1, 10);
+    map.emplace(0, 20);
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_TRUE(map.contains(0));
+    EXPECT_TRUE(map.contains(1));
+    EXPECT_FALSE(map.contains(2));
+    EXPECT_EQ(map.find(0)->second, 20);
+    EXPECT_EQ(map.find(2), map.end());
+}
+
+TEST_F(DenseMapTest, EmplaceDuplicateTest)
+{
+    sd::DenseMap<std::unique_ptr<int>> map;
+    auto first = map.emplace(4, std::make_unique<int>(1));
+    auto second = map.emplace(4, std::make_unique<int>(2));
+
+    EXPECT_TRUE(first.second);
+    EXPECT_FALSE(second.second);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(*second.first->second, 1);
+}
+
+TEST_F(DenseMapTest, EraseTest)
+{
+    sd::DenseMap<int> map;
+    for (size_t key = 0; key < 10; ++key)
+    {
+        map.emplace(9 - key, static_cast<int>(key));
+    }
+
+    map.erase(map.find(4));
+    EXPECT_FALSE(map.contains(4));
+    EXPECT_TRUE(map.contains(5));
+    EXPECT_EQ(getKeys(map), (std::vector<size_t>{0, 1, 2, 3, 5, 6, 7, 8, 9}));
+
+    EXPECT_EQ(map.erase_if([](const sd::DenseMap<int>::Entry &entry) { return entry.first % 2 == 0; }), 4);
+    EXPECT_EQ(getKeys(map), (std::vector<size_t>{1, 3, 5, 7, 9}));
+    EXPECT_EQ(map.find(7)->second, 2);
+    EXPECT_FALSE(map.contains(8));
+}
+
+TEST_F(DenseMapTest, EraseManyEntriesTest)
+{
+    sd::DenseMap<size_t> map;
+    for (size_t key = 0; key < 1000; ++key)
+    {
+        map.emplace(key * 64, key);
+    }
+    for (size_t key = 0; key < 1000; key += 3)
+    {
+        map.erase(map.find(key * 64));
+    }
+
+    EXPECT_EQ(map.size(), 666);
+    for (size_t key = 0; key < 1000; ++key)
+    {
+        auto found = map.find(key * 64);
+        if (key % 3 == 0)
+        {
+            EXPECT_EQ(found, map.end());
+        }
+        else
+        {
+            ASSERT_NE(found, map.end());
+            EXPECT_EQ(found->second, key);
+        }
+    }
+    auto keys = getKeys(map);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+}
+
+TEST_F(DenseMapTest, ManyEntriesTest)
+{
+    sd::DenseMap<size_t> map;
+    for (size_t key = 0; key < 10000; ++key)
+    {
+        map.emplace(key * 7919 % 10007, key);
+    }
+
+    EXPECT_EQ(map.size(), 10000);
+    auto keys = getKeys(map);
+    EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    for (size_t key = 0; key < 10000; ++key)
+    {
+        auto found = map.find(key * 7919 % 10007);
+        ASSERT_NE(found, map.end());
+        EXPECT_EQ(found->second, key);
+    }
+}
\ No newline at end of file
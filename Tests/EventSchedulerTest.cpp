@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class EventSchedulerTest : public ::testing::Test
+{
+  protected:
+    EventSchedulerTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    std::string runSimulation(void (*fill)(sd::Factory &), size_t maxIterations,
+                              const sd::Factory::RaportGuard &guard, sd::SimulationEngine engine)
+    {
+        resetRepetableSimulation();
+
+        sd::Factory factory;
+        fill(factory);
+
+        std::stringstream out;
+        factory.run(maxIterations, out, guard, {engine});
+        out << factory.generateStateRaport();
+        return out.str();
+    }
+
+    ~EventSchedulerTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(EventSchedulerTest, SameRaportsAsTickEngineTest)
+{
+    auto expected = runSimulation(&fillExampleFactory, 500, {size_t{7}}, sd::SimulationEngine::TICK);
+    auto actual = runSimulation(&fillExampleFactory, 500, {size_t{7}}, sd::SimulationEngine::EVENT);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(EventSchedulerTest, SameRaportTimesAsTickEngineTest)
+{
+    std::vector<size_t> times = {0, 1, 2, 19, 20, 250, 251, 499, 500, 800};
+    auto expected = runSimulation(&fillExampleFactory, 500, {times}, sd::SimulationEngine::TICK);
+    auto actual = runSimulation(&fillExampleFactory, 500, {times}, sd::SimulationEngine::EVENT);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(EventSchedulerTest, SlowWorkersSameRaportsAsTickEngineTest)
+{
+    auto expected =
+        runSimulation(&fillSlowFactory, 3000, {size_t{113}}, sd::SimulationEngine::TICK);
+    auto actual =
+        runSimulation(&fillSlowFactory, 3000, {size_t{113}}, sd::SimulationEngine::EVENT);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(EventSchedulerTest, NoRaportsTest)
+{
+    auto expected = runSimulation(&fillSlowFactory, 1000, {size_t{0}}, sd::SimulationEngine::TICK);
+    auto actual =
+        runSimulation(&fillSlowFactory, 1000, {size_t{0}}, sd::SimulationEngine::EVENT);
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(EventSchedulerTest, NextRaportTimeTest)
+{
+    sd::Factory::RaportGuard intervalGuard{size_t{20}};
+    sd::Factory::RaportGuard timesGuard{std::vector<size_t>{40, 3, 17}};
+    sd::Factory::RaportGuard disabledGuard{size_t{0}};
+
+    EXPECT_EQ(intervalGuard.getNextRaportTime(0), 0);
+    EXPECT_EQ(intervalGuard.getNextRaportTime(1), 20);
+    EXPECT_EQ(intervalGuard.getNextRaportTime(40), 40);
+    EXPECT_EQ(timesGuard.getNextRaportTime(0), 3);
+    EXPECT_EQ(timesGuard.getNextRaportTime(4), 17);
+    EXPECT_EQ(timesGuard.getNextRaportTime(41), std::nullopt);
+    EXPECT_EQ(disabledGuard.getNextRaportTime(0), std::nullopt);
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "EventTrace.hpp"
+#include "Factory.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+#include "TraceReader.hpp"
+#include "TraceWriter.hpp"
+
+class EventTraceTest : public ::testing::Test
+{
+  protected:
+    const std::string traceFile = "eventTraceTest.trace";
+
+    EventTraceTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(traceFile);
+    }
+
+    std::vector<sd::EventTrace::Event> runTraced(void (*fill)(sd::Factory &), size_t maxIterations,
+                                                 sd::RunOptions options)
+    {
+        options.traceFile = traceFile;
+        runRepetableSimulation(fill, maxIterations, {size_t{0}}, options);
+        return sd::TraceReader{traceFile}.readAll();
+    }
+
+    ~EventTraceTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    void fillChainFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 2});
+        factory.addWorker({1, 3, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    }
+} // namespace
+
+TEST_F(EventTraceTest, VarintTest)
+{
+    for (uint64_t value : {uint64_t{0}, uint64_t{127}, uint64_t{128}, uint64_t{300}, ~uint64_t{0}})
+    {
+        uint8_t buffer[10];
+        auto end = sd::EventTrace::writeVarint(buffer, value);
+        uint64_t read;
+        EXPECT_EQ(sd::EventTrace::readVarint(buffer, end, read), end);
+        EXPECT_EQ(read, value);
+    }
+    uint8_t truncated[] = {0x80, 0x80};
+    uint64_t read;
+    EXPECT_THROW(sd::EventTrace::readVarint(truncated, truncated + 2, read), std::runtime_error);
+}
+
+TEST_F(EventTraceTest, WriterTruncatesFileTest)
+{
+    {
+        sd::TraceWriter writer{traceFile};
+        std::vector<uint8_t> data(1000, 7);
+        for (size_t index = 0; index < 100; ++index)
+        {
+            writer.append(data.data(), data.size());
+        }
+        EXPECT_EQ(writer.getSize(), 100000);
+    }
+    EXPECT_EQ(std::filesystem::file_size(traceFile), 100000);
+}
+
+TEST_F(EventTraceTest, RecordAndReadTest)
+{
+    {
+        sd::TraceWriter writer{traceFile};
+        sd::EventTrace trace{writer, 5};
+        trace.record(sd::EventTrace::PRODUCT_CREATED, 1, 2);
+        trace.setTime(1005);
+        trace.record(sd::EventTrace::ENQUEUE, 1, 3, 4);
+        trace.setTime(1005);
+        trace.record(sd::EventTrace::SERVICE_END, 1, 3);
+        EXPECT_THROW(trace.setTime(7), std::runtime_error);
+        trace.flush();
+        writer.close();
+    }
+
+    sd::TraceReader reader{traceFile};
+    EXPECT_EQ(reader.getStartTime(), 5);
+    std::vector<sd::EventTrace::Event> expected = {{5, sd::EventTrace::PRODUCT_CREATED, 1, 2},
+                                                   {1005, sd::EventTrace::ENQUEUE, 1, 3, 4},
+                                                   {1005, sd::EventTrace::SERVICE_END, 1, 3}};
+    EXPECT_EQ(reader.readAll(), expected);
+}
+
+TEST_F(EventTraceTest, InvalidHeaderTest)
+{
+    std::vector<uint8_t> data = {'S', 'D', 'X', 'R', 1, 0};
+
+    EXPECT_THROW(
+        try { sd::TraceReader{data}; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Trace has invalid header", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(EventTraceTest, ChainFactoryTraceTest)
+{
+    using enum sd::EventTrace::EventType;
+    std::vector<sd::EventTrace::Event> expected = {
+        {1, PRODUCT_CREATED, 0, 1}, {1, LINK_HOP, 0, 1},      {1, ENQUEUE, 0, 1, 1},      {1, SERVICE_START, 0, 1},
+        {3, PRODUCT_CREATED, 1, 1}, {3, LINK_HOP, 1, 1},      {3, ENQUEUE, 1, 1, 1},      {3, SERVICE_END, 0, 1},
+        {3, SERVICE_START, 1, 1},   {4, LINK_HOP, 0, 2},      {4, STORE_ARRIVAL, 0, 1, 1}, {5, PRODUCT_CREATED, 2, 1},
+        {5, LINK_HOP, 2, 1},        {5, ENQUEUE, 2, 1, 1},    {6, SERVICE_END, 1, 1},     {6, SERVICE_START, 2, 1}};
+
+    EXPECT_EQ(runTraced(&fillChainFactory, 7, {}), expected);
+}
+
+TEST_F(EventTraceTest, SameTraceAcrossEnginesTest)
+{
+    auto expected = runTraced(&fillSlowFactory, 2000, {sd::SimulationEngine::TICK});
+    auto parallel = runTraced(&fillSlowFactory, 2000, {sd::SimulationEngine::PARALLEL, 3});
+    auto events = runTraced(&fillSlowFactory, 2000, {sd::SimulationEngine::EVENT});
+
+    EXPECT_EQ(parallel, expected);
+    std::sort(expected.begin(), expected.end());
+    std::sort(events.begin(), events.end());
+    EXPECT_EQ(events, expected);
+}
+
+TEST_F(EventTraceTest, BoundedFactoryTraceTest)
+{
+    auto expected = runTraced(&fillBoundedFactory, 600, {sd::SimulationEngine::TICK});
+    auto parallel = runTraced(&fillBoundedFactory, 600, {sd::SimulationEngine::PARALLEL, 3});
+    auto events = runTraced(&fillBoundedFactory, 600, {sd::SimulationEngine::EVENT});
+
+    EXPECT_EQ(parallel, expected);
+    std::sort(events.begin(), events.end());
+    auto sorted = expected;
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(events, sorted);
+    auto full = std::find_if(expected.begin(), expected.end(), [](const sd::EventTrace::Event &event) {
+        return event.type == sd::EventTrace::ENQUEUE && event.id == 3 && event.queueSize == 1;
+    });
+    EXPECT_NE(full, expected.end());
+}
+
+TEST_F(EventTraceTest, FlatEngineNotSupportedTest)
+{
+    EXPECT_THROW(
+        try { runTraced(&fillExampleFactory, 10, {sd::SimulationEngine::FLAT}); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Flat engine does not support event trace", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,389 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "FactoryEdit.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+namespace
+{
+    void fillExampleFactoryInEdit(sd::Factory &factory)
+    {
+        auto edit = factory.edit();
+        edit.addLoadingRamp({1, 3});
+        edit.addLoadingRamp({2, 2});
+        edit.addWorker({1, 2, sd::WorkerType::FIFO});
+        edit.addWorker({2, 1, sd::WorkerType::FIFO});
+        edit.addWorker({22, 10, sd::WorkerType::FIFO});
+        edit.addStorehouse({1});
+        edit.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        edit.addLink({2, 0.3, {2, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        edit.addLink({3, 0.7, {2, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+        edit.addLink({4, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+        edit.addLink({5, 0.5, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+        edit.addLink({6, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+        edit.addLink({7, 1, {22, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+        edit.addLink({8, 1, {1, sd::NodeType::RAMP}, {22, sd::NodeType::WORKER}});
+        edit.commit();
+    }
+
+    template <class Function> void expectError(Function function, const char *message)
+    {
+        EXPECT_THROW(
+            try { function(); } catch (const std::runtime_error &e) {
+                EXPECT_STREQ(message, e.what());
+                throw;
+            },
+            std::runtime_error);
+    }
+} // namespace
+
+class FactoryEditTest : public ::testing::Test
+{
+  protected:
+    FactoryEditTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~FactoryEditTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(FactoryEditTest, SameRaportsAsAddedStructureTest)
+{
+    auto expected = runRepetableSimulation(&fillExampleFactory, 300, {size_t{7}}, {});
+    auto actual = runRepetableSimulation(&fillExampleFactoryInEdit, 300, {size_t{7}}, {});
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(FactoryEditTest, RemoveAndReplaceTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+
+    auto edit = factory.edit();
+    edit.removeWorker(2);
+    edit.removeLink(8);
+    edit.addWorker({2, 4, sd::WorkerType::LIFO});
+    edit.addLink({9, 0.5, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    edit.addLink({10, 1, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+    edit.addLink({11, 1, {2, sd::NodeType::WORKER}, {22, sd::NodeType::WORKER}});
+    edit.addLink({12, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    edit.commit();
+
+    sd::Factory expected;
+    expected.addLoadingRamp({1, 3});
+    expected.addLoadingRamp({2, 2});
+    expected.addWorker({1, 2, sd::WorkerType::FIFO});
+    expected.addWorker({2, 4, sd::WorkerType::LIFO});
+    expected.addWorker({22, 10, sd::WorkerType::FIFO});
+    expected.addStorehouse({1});
+    expected.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    expected.addLink({2, 0.3, {2, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    expected.addLink({4, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    expected.addLink({7, 1, {22, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    expected.addLink({9, 0.5, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    expected.addLink({10, 1, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+    expected.addLink({11, 1, {2, sd::NodeType::WORKER}, {22, sd::NodeType::WORKER}});
+    expected.addLink({12, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+
+    EXPECT_TRUE(cmp(factory.getWorkersData(), expected.getWorkersData()));
+    EXPECT_TRUE(cmp(factory.getLinksData(), expected.getLinksData()));
+    EXPECT_EQ(factory.generateStructureRaport(), expected.generateStructureRaport());
+    EXPECT_NO_THROW(factory.validate());
+}
+
+TEST_F(FactoryEditTest, RemovalCancelsEarlierAdditionsTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+
+    auto edit = factory.edit();
+    edit.addWorker({3, 1, sd::WorkerType::FIFO});
+    edit.addLink({9, 1, {1, sd::NodeType::WORKER}, {3, sd::NodeType::WORKER}});
+    edit.addLink({10, 1, {3, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    edit.removeWorker(3);
+    edit.addLink({11, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    edit.removeLink(11);
+    edit.commit();
+
+    EXPECT_EQ(factory.getWorkersData().size(), 3);
+    EXPECT_EQ(factory.getLinksData().size(), 8);
+}
+
+TEST_F(FactoryEditTest, CancelledAdditionMustBeUniqueTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto existingWorker = factory.edit();
+    existingWorker.addWorker({1, 1, sd::WorkerType::FIFO});
+    existingWorker.removeWorker(1);
+    expectError([&] { existingWorker.commit(); }, "Worker of id 1 was already created.");
+
+    auto addedTwice = factory.edit();
+    addedTwice.addStorehouse({5});
+    addedTwice.addStorehouse({5});
+    addedTwice.removeStorehouse(5);
+    expectError([&] { addedTwice.commit(); }, "Storehouse of id 5 was already created.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+
+    auto replacedWorker = factory.edit();
+    replacedWorker.removeWorker(1);
+    replacedWorker.addWorker({1, 1, sd::WorkerType::FIFO});
+    replacedWorker.removeWorker(1);
+    replacedWorker.commit();
+    EXPECT_EQ(factory.getWorkersData().size(), 2);
+}
+
+TEST_F(FactoryEditTest, CancelledRampAdditionMustBeUniqueTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto existingRamp = factory.edit();
+    existingRamp.addLoadingRamp({1, 3});
+    existingRamp.removeLoadingRamp(1);
+    expectError([&] { existingRamp.commit(); }, "Loading ramp of id 1 was already created.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+
+    auto replacedRamp = factory.edit();
+    replacedRamp.removeLoadingRamp(2);
+    replacedRamp.addLoadingRamp({2, 2});
+    replacedRamp.removeLoadingRamp(2);
+    replacedRamp.commit();
+    EXPECT_EQ(factory.getLoadingRampsData().size(), 1);
+}
+
+TEST_F(FactoryEditTest, CancelledLinkAdditionMustBeValidTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto existingLink = factory.edit();
+    existingLink.addLink({8, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    existingLink.removeLink(8);
+    expectError([&] { existingLink.commit(); }, "Link of id 8 was already created.");
+
+    auto addedTwice = factory.edit();
+    addedTwice.addLink({9, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    addedTwice.addLink({9, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    addedTwice.removeLink(9);
+    expectError([&] { addedTwice.commit(); }, "Link of id 9 was already created.");
+
+    auto storeSource = factory.edit();
+    storeSource.addLink({9, 1, {1, sd::NodeType::STORE}, {1, sd::NodeType::WORKER}});
+    storeSource.removeLink(9);
+    expectError([&] { storeSource.commit(); }, "Storehouse cannot be used as link source.");
+
+    auto missingDestination = factory.edit();
+    missingDestination.addLink({9, 1, {2, sd::NodeType::WORKER}, {5, sd::NodeType::STORE}});
+    missingDestination.removeLink(9);
+    expectError([&] { missingDestination.commit(); }, "Could not find Storehouse of id 5 to be link destination.");
+
+    auto zeroProbability = factory.edit();
+    zeroProbability.addLink({9, 0, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    zeroProbability.removeWorker(2);
+    expectError([&] { zeroProbability.commit(); }, "Probability Cannot be set to 0.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+
+    auto replacedLink = factory.edit();
+    replacedLink.removeLink(8);
+    replacedLink.addLink({8, 1, {22, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    replacedLink.removeWorker(22);
+    replacedLink.commit();
+    EXPECT_EQ(factory.getLinksData().size(), 6);
+    EXPECT_NO_THROW(factory.validate());
+}
+
+TEST_F(FactoryEditTest, CancelledLinkEndpointsMustBeLiveTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto removedSource = factory.edit();
+    removedSource.removeWorker(1);
+    removedSource.addLink({9, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    removedSource.removeLink(9);
+    expectError([&] { removedSource.commit(); }, "Could not find Worker of id 1 to be link source.");
+
+    auto missingSource = factory.edit();
+    missingSource.addLink({9, 1, {7, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    missingSource.removeLink(9);
+    expectError([&] { missingSource.commit(); }, "Could not find LoadingRamp of id 7 to be link source.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+
+    auto removedDestination = factory.edit();
+    removedDestination.addWorker({5, 1, sd::WorkerType::FIFO});
+    removedDestination.addLink({9, 1, {1, sd::NodeType::RAMP}, {5, sd::NodeType::WORKER}});
+    removedDestination.removeWorker(5);
+    removedDestination.commit();
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+}
+
+TEST_F(FactoryEditTest, KeptLinkAdditionMustBeUniqueTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto existingLink = factory.edit();
+    existingLink.addLink({8, 1, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    existingLink.removeWorker(22);
+    expectError([&] { existingLink.commit(); }, "Link of id 8 was already created.");
+
+    auto addedTwice = factory.edit();
+    addedTwice.addWorker({5, 1, sd::WorkerType::FIFO});
+    addedTwice.addLink({9, 1, {1, sd::NodeType::RAMP}, {5, sd::NodeType::WORKER}});
+    addedTwice.addLink({9, 1, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    addedTwice.removeWorker(5);
+    expectError([&] { addedTwice.commit(); }, "Link of id 9 was already created.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+
+    auto replacedLink = factory.edit();
+    replacedLink.removeWorker(22);
+    replacedLink.addLink({8, 1, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    replacedLink.commit();
+    EXPECT_EQ(factory.getLinksData().size(), 7);
+    EXPECT_NO_THROW(factory.validate());
+}
+
+TEST_F(FactoryEditTest, LinkBeforeItsNodeTest)
+{
+    sd::Factory empty;
+    auto missingSource = empty.edit();
+    missingSource.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    missingSource.addLoadingRamp({1, 3});
+    missingSource.addWorker({1, 2, sd::WorkerType::FIFO});
+    expectError([&] { missingSource.commit(); }, "Could not find LoadingRamp of id 1 to be link source.");
+    EXPECT_TRUE(empty.getLinksData().empty());
+
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto missingDestination = factory.edit();
+    missingDestination.addLink({9, 1, {2, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}});
+    missingDestination.addStorehouse({2});
+    expectError([&] { missingDestination.commit(); }, "Could not find Storehouse of id 2 to be link destination.");
+
+    auto removedSource = factory.edit();
+    removedSource.removeWorker(1);
+    removedSource.addLink({9, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    removedSource.addWorker({1, 2, sd::WorkerType::FIFO});
+    expectError([&] { removedSource.commit(); }, "Could not find Worker of id 1 to be link source.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+}
+
+TEST_F(FactoryEditTest, LinkToRemovedDestinationTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto removedDestination = factory.edit();
+    removedDestination.removeWorker(2);
+    removedDestination.addLink({9, 1, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    removedDestination.addWorker({2, 1, sd::WorkerType::FIFO});
+    expectError([&] { removedDestination.commit(); }, "Could not find Worker of id 2 to be link destination.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+
+    auto readdedDestination = factory.edit();
+    readdedDestination.removeWorker(2);
+    readdedDestination.addWorker({2, 1, sd::WorkerType::FIFO});
+    readdedDestination.addLink({9, 1, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    readdedDestination.addLink({10, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    readdedDestination.commit();
+    EXPECT_EQ(factory.getLinksData().size(), 7);
+    EXPECT_NO_THROW(factory.validate());
+}
+
+TEST_F(FactoryEditTest, ReusedLinkIdTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+
+    auto removedLink = factory.edit();
+    removedLink.removeLink(8);
+    removedLink.addLink({8, 0.5, {1, sd::NodeType::RAMP}, {22, sd::NodeType::WORKER}});
+    removedLink.commit();
+    EXPECT_EQ(factory.getLinksData().size(), 8);
+
+    auto removedDestination = factory.edit();
+    removedDestination.removeStorehouse(1);
+    removedDestination.addStorehouse({1});
+    removedDestination.addLink({6, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    removedDestination.addLink({7, 1, {22, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    removedDestination.commit();
+    EXPECT_EQ(factory.getLinksData().size(), 8);
+    EXPECT_NO_THROW(factory.validate());
+}
+
+TEST_F(FactoryEditTest, FailedCommitKeepsFactoryTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto edit = factory.edit();
+    edit.removeLink(6);
+    edit.removeWorker(22);
+    edit.addWorker({3, 1, sd::WorkerType::FIFO});
+    edit.addLink({9, 1, {1, sd::NodeType::WORKER}, {3, sd::NodeType::WORKER}});
+    edit.addLink({10, 1, {3, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+
+    expectError([&] { edit.commit(); }, "Worker of id 2 is not connected as source.");
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+
+    edit.addLink({11, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    edit.commit();
+    EXPECT_NO_THROW(factory.validate());
+    EXPECT_EQ(factory.getLinksData().size(), 8);
+    expectError([&] { edit.removeLink(1); }, "Factory edit was already committed.");
+}
+
+TEST_F(FactoryEditTest, InvalidEditsTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    auto structure = factory.generateStructureRaport();
+
+    auto duplicatedWorker = factory.edit();
+    duplicatedWorker.addWorker({22, 1, sd::WorkerType::FIFO});
+    expectError([&] { duplicatedWorker.commit(); }, "Worker of id 22 was already created.");
+
+    auto duplicatedLink = factory.edit();
+    duplicatedLink.addLink({8, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    expectError([&] { duplicatedLink.commit(); }, "Link of id 8 was already created.");
+
+    auto removedDestination = factory.edit();
+    removedDestination.removeStorehouse(1);
+    removedDestination.addLink({9, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    expectError([&] { removedDestination.commit(); }, "Could not find Storehouse of id 1 to be link destination.");
+
+    auto rampToStore = factory.edit();
+    rampToStore.addLink({9, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::STORE}});
+    expectError([&] { rampToStore.commit(); }, "Cannot bind Ramp and Store.");
+
+    EXPECT_EQ(factory.generateStructureRaport(), structure);
+}
\ No newline at end of file
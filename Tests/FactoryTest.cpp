@@ -1,3 +1,4 @@
+#include <cmath>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <iostream>
@@ -48,10 +49,10 @@ TEST_F(FactoryTest, SimpleSimulationTest)
     sd::StoreHouse store1{2};
     sd::StoreHouse store2{1};
     sd::StoreHouse store3{1};
-    auto link1 = std::make_shared<sd::Link>(1, 0.5, ramp, worker);
-    auto link2 = std::make_shared<sd::Link>(1, 0.2, worker, store1);
-    auto link3 = std::make_shared<sd::Link>(1, 0.5, worker, store2);
-    auto link4 = std::make_shared<sd::Link>(1, 0.3, worker, store3);
+    sd::Link link1{1, 0.5, ramp, worker};
+    sd::Link link2{1, 0.2, worker, store1};
+    sd::Link link3{1, 0.5, worker, store2};
+    sd::Link link4{1, 0.3, worker, store3};
 
     ramp.bindSourceLink(link1);
     worker.bindDestinationLink(link1);
@@ -73,9 +74,15 @@ TEST_F(FactoryTest, SimpleSimulationTest)
         worker.process(cnt);
     }
 
-    EXPECT_EQ(store1.getStoredProductsSize(), 193);
-    EXPECT_EQ(store2.getStoredProductsSize(), 502);
-    EXPECT_EQ(store3.getStoredProductsSize(), 304);
+    // the particular link chosen for a draw depends on the alias table, so only the routing distribution is pinned
+    auto expectRouted = [&](const sd::StoreHouse &store, double propability) {
+        const auto products = static_cast<double>(expectedLoops - 1);
+        EXPECT_NEAR(store.getStoredProductsSize(), products * propability,
+                    4 * std::sqrt(products * propability * (1 - propability)));
+    };
+    expectRouted(store1, 0.2);
+    expectRouted(store2, 0.5);
+    expectRouted(store3, 0.3);
     EXPECT_EQ((store1.getStoredProductsSize() + store2.getStoredProductsSize() + store3.getStoredProductsSize()),
               (expectedLoops - 1));
 }
@@ -97,9 +104,9 @@ TEST_F(FactoryTest, SimpleSimulationDelayedTest)
     sd::Worker worker{3};
     sd::Worker worker2{4};
     sd::StoreHouse store1{2};
-    auto link1 = std::make_shared<sd::Link>(1, 1, ramp, worker);
-    auto link2 = std::make_shared<sd::Link>(2, 1, worker, worker2);
-    auto link3 = std::make_shared<sd::Link>(3, 1, worker2, store1);
+    sd::Link link1{1, 1, ramp, worker};
+    sd::Link link2{2, 1, worker, worker2};
+    sd::Link link3{3, 1, worker2, store1};
 
     ramp.bindSourceLink(link1);
     worker.bindDestinationLink(link1);
@@ -567,6 +574,17 @@ TEST_F(FactoryTest, StructureRaportTest)
     EXPECT_EQ(factory.generateStructureRaport(), expectedRaport);
 }
 
+TEST_F(FactoryTest, RunWithoutStructureRaportTest)
+{
+    auto withStructure = runRepetableSimulation(&fillExampleFactory, 50, {size_t{10}}, {});
+    sd::RunOptions options;
+    options.structureRaport = false;
+    auto withoutStructure = runRepetableSimulation(&fillExampleFactory, 50, {size_t{10}}, options);
+
+    EXPECT_TRUE(withoutStructure.starts_with("========= Iteration: 0 ========="));
+    EXPECT_TRUE(withStructure.ends_with(withoutStructure));
+}
+
 TEST_F(FactoryTest, RunBasicSimulationTest)
 {
     sd::Factory factory;
@@ -812,3 +830,39 @@ TEST_F(FactoryTest, RunComplexSimulationTest)
         "#4\n\tQueue: #3, #8, #17, #27, #36\n\n";
     EXPECT_EQ(out.str(), expectedOut);
 }
+
+
+TEST_F(FactoryTest, CloneStructureTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+
+    auto clone = factory.cloneStructure();
+
+    EXPECT_TRUE(cmp(clone->getLoadingRampsData(), factory.getLoadingRampsData()));
+    EXPECT_TRUE(cmp(clone->getWorkersData(), factory.getWorkersData()));
+    EXPECT_TRUE(cmp(clone->getStorehousesData(), factory.getStorehousesData()));
+    EXPECT_TRUE(cmp(clone->getLinksData(), factory.getLinksData()));
+    EXPECT_EQ(clone->generateStructureRaport(), factory.generateStructureRaport());
+}
+
+TEST_F(FactoryTest, ContextSimulationTest)
+{
+    auto expected = runRepetableSimulation(&fillExampleFactory, 200, {size_t{9}}, {sd::SimulationEngine::TICK});
+    auto globalIdSeed = sd::Product::getIdSeed();
+
+    for (auto engine : {sd::SimulationEngine::TICK, sd::SimulationEngine::EVENT, sd::SimulationEngine::PARALLEL,
+                        sd::SimulationEngine::FLAT})
+    {
+        sd::Factory factory;
+        fillExampleFactory(factory);
+        factory.setContext(std::make_shared<sd::SimulationContext>(std::make_unique<RepetableRandomDevice>()));
+
+        std::stringstream out;
+        factory.run(200, out, {size_t{9}}, {engine, 2});
+
+        EXPECT_EQ(out.str(), expected);
+        EXPECT_EQ(factory.getContext()->getProductIdSeed(), globalIdSeed);
+    }
+    EXPECT_EQ(sd::Product::getIdSeed(), globalIdSeed);
+}
\ No newline at end of file
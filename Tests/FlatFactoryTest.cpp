@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "FlatFactory.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class FlatFactoryTest : public ::testing::Test
+{
+  protected:
+    FlatFactoryTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~FlatFactoryTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(FlatFactoryTest, SameRaportsAsTickEngineTest)
+{
+    auto expected = runRepetableSimulation(&fillExampleFactory, 500, {size_t{7}}, {sd::SimulationEngine::TICK});
+    auto actual = runRepetableSimulation(&fillExampleFactory, 500, {size_t{7}}, {sd::SimulationEngine::FLAT});
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(FlatFactoryTest, SlowWorkersSameRaportsAsTickEngineTest)
+{
+    auto expected = runRepetableSimulation(&fillSlowFactory, 3000, {size_t{97}}, {sd::SimulationEngine::TICK});
+    auto actual = runRepetableSimulation(&fillSlowFactory, 3000, {size_t{97}}, {sd::SimulationEngine::FLAT});
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(FlatFactoryTest, SameStateAfterRunAsTickEngineTest)
+{
+    auto runTwice = [](sd::SimulationEngine engine) {
+        resetRepetableSimulation();
+        sd::Factory factory;
+        fillSlowFactory(factory);
+        std::stringstream out;
+        factory.run(1000, out, {size_t{0}}, {engine});
+        auto state = factory.generateStateRaport();
+
+        sd::RunOptions options;
+        options.startTime = 1000;
+        options.raportMode = sd::RaportMode::SUMMARY;
+        std::stringstream resumed;
+        factory.run(1500, resumed, {std::vector<size_t>{1000, 1499}}, options);
+        return std::pair{state, resumed.str()};
+    };
+
+    auto [expectedState, expectedResumedRaport] = runTwice(sd::SimulationEngine::TICK);
+    auto [actualState, actualResumedRaport] = runTwice(sd::SimulationEngine::FLAT);
+
+    EXPECT_EQ(actualState, expectedState);
+    EXPECT_EQ(actualResumedRaport, expectedResumedRaport);
+}
+
+TEST_F(FlatFactoryTest, CompiledRunTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream expected;
+    factory.run(100, expected, {std::vector<size_t>{99}});
+    auto expectedIdSeed = sd::Product::getIdSeed();
+
+    resetRepetableSimulation();
+    sd::Factory compiledFactory;
+    fillExampleFactory(compiledFactory);
+    sd::FlatFactory flatFactory{compiledFactory};
+    std::stringstream actual;
+    flatFactory.run(100, actual, {size_t{0}}, sd::Random::get());
+
+    EXPECT_TRUE(expected.str().ends_with(flatFactory.generateStateRaport()));
+    EXPECT_EQ(sd::Product::getIdSeed(), expectedIdSeed);
+}
+
+TEST_F(FlatFactoryTest, CompileInvalidFactoryTest)
+{
+    sd::Factory factory;
+
+    factory.addLoadingRamp({1, 1});
+    factory.addWorker({1, 1, sd::WorkerType::FIFO});
+    factory.addLink({1, 0.5, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+
+    EXPECT_THROW(
+        try { sd::FlatFactory{factory}; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Worker of id 1 is not connected as source.", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(FlatFactoryTest, CompileFactoryWithProductsTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream out;
+    factory.run(10, out, {size_t{0}});
+
+    EXPECT_THROW(
+        try { sd::FlatFactory{factory}; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Factory with products in flight cannot be compiled.", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "LatencyTracker.hpp"
+#include "BinaryRaportSink.hpp"
+#include "TextRaportSink.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class LatencyTrackerTest : public ::testing::Test
+{
+  protected:
+    LatencyTrackerTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    std::string runTracked(void (*fill)(sd::Factory &), size_t maxIterations, sd::SimulationEngine engine)
+    {
+        resetRepetableSimulation();
+        sd::Factory factory;
+        fill(factory);
+
+        sd::RunOptions options;
+        options.engine = engine;
+        options.threads = 3;
+        options.trackLatency = true;
+        std::stringstream out;
+        factory.run(maxIterations, out, {size_t{0}}, options);
+        return factory.getLatencyTracker()->generateRaport();
+    }
+
+    ~LatencyTrackerTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    void fillChainFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 3});
+        factory.addWorker({1, 2, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    }
+
+    void fillCongestedFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 1});
+        factory.addWorker({1, 2, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    }
+
+    void expectStatistic(const sd::LatencyStatistic &statistic, uint64_t count, uint64_t sum, uint64_t max)
+    {
+        EXPECT_EQ(statistic.count, count);
+        EXPECT_EQ(statistic.sum, sum);
+        EXPECT_EQ(statistic.max, max);
+    }
+} // namespace
+
+TEST_F(LatencyTrackerTest, DisabledByDefaultTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    std::stringstream out;
+    factory.run(30, out, {size_t{0}});
+
+    EXPECT_EQ(factory.getLatencyTracker(), nullptr);
+    EXPECT_EQ(out.str().find("Latency Raport"), std::string::npos);
+}
+
+TEST_F(LatencyTrackerTest, ChainLatencyTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    sd::RunOptions options;
+    options.trackLatency = true;
+    std::stringstream out;
+    factory.run(30, out, {size_t{0}}, options);
+
+    auto tracker = factory.getLatencyTracker();
+    ASSERT_NE(tracker, nullptr);
+    auto &worker = tracker->getWorkerLatency(1);
+    expectStatistic(worker.waiting, 10, 0, 0);
+    expectStatistic(worker.service, 9, 18, 2);
+    expectStatistic(worker.sojourn, 9, 18, 2);
+
+    auto &store = tracker->getStoreHouseLatency(1);
+    expectStatistic(store.sojourn, 9, 18, 2);
+    expectStatistic(store.waiting, 9, 0, 0);
+    expectStatistic(store.service, 9, 18, 2);
+
+    EXPECT_TRUE(out.str().ends_with(tracker->generateRaport()));
+}
+
+TEST_F(LatencyTrackerTest, CongestedLatencyTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillCongestedFactory(factory);
+
+    sd::RunOptions options;
+    options.trackLatency = true;
+    std::stringstream out;
+    factory.run(20, out, {size_t{0}}, options);
+
+    auto tracker = factory.getLatencyTracker();
+    auto &worker = tracker->getWorkerLatency(1);
+    expectStatistic(worker.waiting, 11, 55, 10);
+    expectStatistic(worker.service, 10, 20, 2);
+    expectStatistic(worker.sojourn, 9, 54, 10);
+
+    auto &store = tracker->getStoreHouseLatency(1);
+    expectStatistic(store.sojourn, 9, 54, 10);
+    expectStatistic(store.waiting, 9, 36, 8);
+    expectStatistic(store.service, 9, 18, 2);
+}
+
+TEST_F(LatencyTrackerTest, EnginesSameLatencyTest)
+{
+    auto expected = runTracked(&fillSlowFactory, 2000, sd::SimulationEngine::TICK);
+
+    EXPECT_EQ(runTracked(&fillSlowFactory, 2000, sd::SimulationEngine::EVENT), expected);
+    EXPECT_EQ(runTracked(&fillSlowFactory, 2000, sd::SimulationEngine::PARALLEL), expected);
+}
+
+TEST_F(LatencyTrackerTest, BoundedEnginesSameLatencyTest)
+{
+    auto expected = runTracked(&fillBoundedFactory, 2000, sd::SimulationEngine::TICK);
+
+    EXPECT_EQ(runTracked(&fillBoundedFactory, 2000, sd::SimulationEngine::EVENT), expected);
+    EXPECT_EQ(runTracked(&fillBoundedFactory, 2000, sd::SimulationEngine::PARALLEL), expected);
+}
+
+TEST_F(LatencyTrackerTest, FlatEngineNotSupportedTest)
+{
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    sd::RunOptions options;
+    options.engine = sd::SimulationEngine::FLAT;
+    options.trackLatency = true;
+    std::stringstream out;
+
+    EXPECT_THROW(
+        {
+            try
+            {
+                factory.run(10, out, {size_t{0}}, options);
+            }
+            catch (const std::runtime_error &e)
+            {
+                EXPECT_STREQ(e.what(), "Flat engine does not support latency tracking");
+                throw;
+            }
+        },
+        std::runtime_error);
+}
+
+TEST_F(LatencyTrackerTest, UnknownNodeTest)
+{
+    sd::LatencyTracker tracker{{}, {}};
+
+    EXPECT_THROW(tracker.getWorkerLatency(1), std::runtime_error);
+    EXPECT_THROW(tracker.getStoreHouseLatency(1), std::runtime_error);
+}
+
+TEST_F(LatencyTrackerTest, RaportSinkTest)
+{
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    std::string text;
+    sd::TextRaportSink sink{text};
+    sd::RunOptions options;
+    options.trackLatency = true;
+    options.raportSink = &sink;
+    std::stringstream out;
+    factory.run(10, out, {size_t{0}}, options);
+
+    auto raport = factory.getLatencyTracker()->generateRaport();
+    EXPECT_TRUE(out.str().empty());
+    ASSERT_GE(text.size(), raport.size());
+    EXPECT_EQ(text.substr(text.size() - raport.size()), raport);
+}
+
+TEST_F(LatencyTrackerTest, BinaryRaportReplayTest)
+{
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    std::vector<uint8_t> buffer;
+    sd::BinaryRaportSink sink{buffer};
+    sd::RunOptions options;
+    options.trackLatency = true;
+    options.raportSink = &sink;
+    std::stringstream out;
+    factory.run(10, out, {size_t{0}}, options);
+
+    std::string text;
+    sd::TextRaportSink textSink{text};
+    sd::BinaryRaportSink::replay(buffer, textSink);
+    auto raport = factory.getLatencyTracker()->generateRaport();
+    ASSERT_GE(text.size(), raport.size());
+    EXPECT_EQ(text.substr(text.size() - raport.size()), raport);
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+
+#include "Factory.hpp"
+#include "LinkTable.hpp"
+#include "Random.hpp"
+#include "StoreHouse.hpp"
+#include "TestHelpers.hpp"
+#include "Worker.hpp"
+
+class LinkTableTest : public ::testing::Test
+{
+  protected:
+    LinkTableTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~LinkTableTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    std::vector<size_t> getIds(const sd::LinkTable &table)
+    {
+        std::vector<size_t> ids;
+        for (auto link : table.getLinksInOrder())
+        {
+            ids.push_back(link->getId());
+        }
+        return ids;
+    }
+} // namespace
+
+TEST_F(LinkTableTest, EmplaceAndFindTest)
+{
+    sd::Worker worker{1};
+    sd::StoreHouse store{1};
+    sd::LinkTable table;
+
+    auto &link = table.emplace({7, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+    table.emplace({3, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+
+    EXPECT_EQ(table.size(), 2);
+    EXPECT_EQ(table.find(7), &link);
+    EXPECT_EQ(table.find(5), nullptr);
+    EXPECT_EQ(getIds(table), (std::vector<size_t>{3, 7}));
+    EXPECT_THROW(
+        try {
+            table.emplace({7, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+        } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Link of id 7 was already created.", e.what());
+            throw;
+        },
+        std::runtime_error);
+    EXPECT_EQ(table.size(), 2);
+}
+
+TEST_F(LinkTableTest, EraseReusesSlotTest)
+{
+    sd::Worker worker{1};
+    sd::StoreHouse store{1};
+    sd::LinkTable table;
+
+    table.emplace({1, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+    auto &second = table.emplace({2, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+    table.erase(1);
+
+    EXPECT_EQ(table.find(1), nullptr);
+    EXPECT_EQ(table.find(2), &second);
+
+    auto &third = table.emplace({3, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+    EXPECT_EQ(table.find(2), &second);
+    EXPECT_EQ(table.find(3), &third);
+    EXPECT_EQ(getIds(table), (std::vector<size_t>{2, 3}));
+
+    table.erase(2);
+    table.erase(3);
+    EXPECT_TRUE(table.empty());
+}
+
+TEST_F(LinkTableTest, OrderKeptOnModificationTest)
+{
+    sd::Worker worker{1};
+    sd::StoreHouse store{1};
+    sd::LinkTable table;
+
+    for (size_t id : {5, 2, 8, 1})
+    {
+        table.emplace({id, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+    }
+    EXPECT_EQ(getIds(table), (std::vector<size_t>{1, 2, 5, 8}));
+
+    table.erase(2);
+    table.erase(8);
+    table.emplace({3, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}, worker, store);
+    EXPECT_EQ(getIds(table), (std::vector<size_t>{1, 3, 5}));
+    EXPECT_EQ(table.getLinksInOrder()[1], table.find(3));
+}
+
+TEST_F(LinkTableTest, RemoveWorkerWithSelfLoopTest)
+{
+    sd::Factory factory;
+    factory.addLoadingRamp({1, 1});
+    factory.addWorker({1, 1, sd::WorkerType::FIFO});
+    factory.addWorker({2, 1, sd::WorkerType::FIFO});
+    factory.addStorehouse({1});
+    factory.addLink({1, 0.5, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    factory.addLink({2, 0.5, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    factory.addLink({3, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    factory.addLink({4, 0.5, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+    factory.addLink({5, 0.5, {2, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    factory.addLink({6, 0.5, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+
+    factory.removeWorker(1);
+
+    EXPECT_TRUE(cmp(factory.getLinksData(), {{2, 0.5, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}},
+                                             {6, 0.5, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}}));
+    EXPECT_NO_THROW(factory.validate());
+
+    factory.addLink({3, 0.5, {2, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+    EXPECT_EQ(factory.getLinksData().size(), 3);
+}
\ No newline at end of file
@@ -106,7 +106,7 @@ TEST_F(LinkTest, UnbindTest)
 {
     sd::Worker worker{3};
     sd::StoreHouse store{2};
-    auto link = std::make_shared<sd::Link>(1, 0.5, worker, store);
+    sd::Link link{1, 0.5, worker, store};
 
     worker.bindSourceLink(link);
     store.bindDestinationLink(link);
@@ -115,9 +115,9 @@ TEST_F(LinkTest, UnbindTest)
     EXPECT_FALSE(worker.connectedDestinations());
     EXPECT_TRUE(store.connectedDestinations());
 
-    link->unBindDestination();
+    link.unBindDestination();
     EXPECT_FALSE(store.connectedDestinations());
 
-    link->unBindSource();
+    link.unBindSource();
     EXPECT_FALSE(worker.connectedSources());
 }
@@ -64,9 +64,9 @@ TEST_F(LoadingRampTest, StructureRaportWithLinksTest)
     auto worker2 = std::make_unique<sd::Worker>(1, sd::WorkerType::FIFO, 3);
     auto worker3 = std::make_unique<sd::Worker>(1, sd::WorkerType::FIFO, 3);
 
-    auto link1 = std::make_shared<sd::Link>(1, 0.5, *loadingRamp, *worker1);
-    auto link2 = std::make_shared<sd::Link>(1, 0.5, *loadingRamp, *worker2);
-    auto link3 = std::make_shared<sd::Link>(1, 0.5, *loadingRamp, *worker3);
+    sd::Link link1{1, 0.5, *loadingRamp, *worker1};
+    sd::Link link2{1, 0.5, *loadingRamp, *worker2};
+    sd::Link link3{1, 0.5, *loadingRamp, *worker3};
 
     loadingRamp->bindSourceLink(link1);
     loadingRamp->bindSourceLink(link2);
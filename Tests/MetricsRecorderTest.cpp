@@ -0,0 +1,202 @@
+#include <algorithm>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "MetricsReader.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class MetricsRecorderTest : public ::testing::Test
+{
+  protected:
+    const std::string metricsFile = "metricsRecorderTest.metrics";
+
+    MetricsRecorderTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(metricsFile);
+    }
+
+    std::vector<std::vector<double>> runMeasured(void (*fill)(sd::Factory &), size_t maxIterations,
+                                                 sd::RunOptions options)
+    {
+        options.metricsFile = metricsFile;
+        runRepetableSimulation(fill, maxIterations, {size_t{0}}, options);
+
+        sd::MetricsReader reader{metricsFile};
+        std::vector<std::vector<double>> columns;
+        for (size_t column = 0; column < reader.getColumns().size(); ++column)
+        {
+            columns.push_back(reader.readColumn(column));
+        }
+        return columns;
+    }
+
+    ~MetricsRecorderTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    void fillChainFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 1});
+        factory.addWorker({1, 3, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    }
+} // namespace
+
+TEST_F(MetricsRecorderTest, RawColumnsTest)
+{
+    auto columns = runMeasured(&fillChainFactory, 10, {});
+
+    sd::MetricsReader reader{metricsFile};
+    EXPECT_EQ(reader.getFirstSampleTime(), 0);
+    EXPECT_EQ(reader.getInterval(), 1);
+    EXPECT_EQ(reader.getWindow(), 0);
+    EXPECT_EQ(reader.getColumns().size(), 3);
+    EXPECT_EQ(reader.findColumn(sd::NodeType::WORKER, 1, sd::MetricsRecorder::QUEUE_LENGTH), 0);
+    EXPECT_EQ(reader.findColumn(sd::NodeType::WORKER, 1, sd::MetricsRecorder::BUSY), 1);
+    EXPECT_EQ(reader.findColumn(sd::NodeType::STORE, 1, sd::MetricsRecorder::QUEUE_LENGTH), 2);
+    EXPECT_EQ(reader.findColumn(sd::NodeType::STORE, 1, sd::MetricsRecorder::BUSY), std::nullopt);
+
+    EXPECT_EQ(columns[0], (std::vector<double>{0, 1, 1, 2, 3, 3, 4, 5, 5, 6}));
+    EXPECT_EQ(columns[1], std::vector<double>(10, 1));
+    EXPECT_EQ(columns[2], (std::vector<double>{0, 0, 0, 1, 1, 1, 2, 2, 2, 3}));
+}
+
+TEST_F(MetricsRecorderTest, SampleIntervalTest)
+{
+    auto columns = runMeasured(&fillChainFactory, 10, {.metricsInterval = 4});
+
+    sd::MetricsReader reader{metricsFile};
+    EXPECT_EQ(reader.getRowTime(2), 8);
+    EXPECT_EQ(columns[0], (std::vector<double>{0, 3, 5}));
+    EXPECT_EQ(columns[2], (std::vector<double>{0, 1, 2}));
+}
+
+TEST_F(MetricsRecorderTest, DownsampledColumnsTest)
+{
+    auto raw = runMeasured(&fillExampleFactory, 1000, {});
+    auto windows = runMeasured(&fillExampleFactory, 1000, {.metricsWindow = 64});
+
+    sd::MetricsReader reader{metricsFile};
+    EXPECT_EQ(reader.getRowTime(1), 64);
+
+    size_t rawColumn = 0;
+    for (size_t column = 0; column < reader.getColumns().size(); ++rawColumn)
+    {
+        auto &samples = raw[rawColumn];
+        auto metric = reader.getColumns()[column].metric;
+        if (metric == sd::MetricsRecorder::BUSY_RATIO)
+        {
+            for (size_t row = 0; row < windows[column].size(); ++row)
+            {
+                auto begin = samples.begin() + row * 64;
+                auto end = samples.begin() + std::min(samples.size(), (row + 1) * 64);
+                EXPECT_FLOAT_EQ(windows[column][row], std::accumulate(begin, end, 0.0) / (end - begin));
+            }
+            ++column;
+            continue;
+        }
+        if (metric != sd::MetricsRecorder::QUEUE_MIN)
+        {
+            continue;
+        }
+        ASSERT_EQ(windows[column].size(), 16);
+        for (size_t row = 0; row < windows[column].size(); ++row)
+        {
+            auto begin = samples.begin() + row * 64;
+            auto end = samples.begin() + std::min(samples.size(), (row + 1) * 64);
+            EXPECT_EQ(windows[column][row], *std::min_element(begin, end));
+            EXPECT_EQ(windows[column + 1][row], *std::max_element(begin, end));
+            EXPECT_FLOAT_EQ(windows[column + 2][row], std::accumulate(begin, end, 0.0) / (end - begin));
+        }
+        column += 3;
+    }
+}
+
+TEST_F(MetricsRecorderTest, SameMetricsAcrossEnginesTest)
+{
+    auto expected = runMeasured(&fillExampleFactory, 2000, {.metricsInterval = 7});
+    auto events = runMeasured(&fillExampleFactory, 2000, {.engine = sd::SimulationEngine::EVENT, .metricsInterval = 7});
+    auto parallel = runMeasured(&fillExampleFactory, 2000,
+                                {.engine = sd::SimulationEngine::PARALLEL, .threads = 3, .metricsInterval = 7});
+
+    EXPECT_EQ(expected.front().size(), 286);
+    EXPECT_EQ(events, expected);
+    EXPECT_EQ(parallel, expected);
+}
+
+TEST_F(MetricsRecorderTest, ManyRowGroupsTest)
+{
+    auto columns = runMeasured(&fillChainFactory, 1500000, {});
+
+    ASSERT_EQ(columns[2].size(), 1500000);
+    EXPECT_EQ(columns[2].back(), 499999);
+    EXPECT_EQ(columns[0].back(), 999999);
+}
+
+TEST_F(MetricsRecorderTest, InvalidIntervalTest)
+{
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    std::stringstream out;
+    EXPECT_THROW(
+        try {
+            factory.run(10, out, {size_t{0}}, {.metricsFile = metricsFile, .metricsInterval = 0});
+        } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Metrics interval must be positive", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(MetricsRecorderTest, FlatEngineNotSupportedTest)
+{
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    std::stringstream out;
+    EXPECT_THROW(
+        try {
+            factory.run(10, out, {size_t{0}}, {.engine = sd::SimulationEngine::FLAT, .metricsFile = metricsFile});
+        } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Flat engine does not support metrics", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(MetricsRecorderTest, InvalidFileTest)
+{
+    std::ofstream{metricsFile} << "not metrics";
+
+    EXPECT_THROW(
+        try { sd::MetricsReader{metricsFile}; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Metrics file has invalid header", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class ParallelSchedulerTest : public ::testing::Test
+{
+  protected:
+    ParallelSchedulerTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    static void fillWideFactory(sd::Factory &factory)
+    {
+        constexpr size_t layers = 3;
+        constexpr size_t layerWidth = 64;
+        constexpr size_t ramps = 4;
+        constexpr size_t stores = 5;
+        size_t linkId = 1;
+
+        for (size_t store = 1; store <= stores; ++store)
+        {
+            factory.addStorehouse({store});
+        }
+        for (size_t worker = 1; worker <= layers * layerWidth; ++worker)
+        {
+            auto type = worker % 3 == 0 ? sd::WorkerType::LIFO : sd::WorkerType::FIFO;
+            factory.addWorker({worker, worker % 7 + 1, type});
+        }
+        for (size_t ramp = 1; ramp <= ramps; ++ramp)
+        {
+            factory.addLoadingRamp({ramp, ramp % 2 + 1});
+            for (size_t worker = ramp; worker <= layerWidth; worker += ramps)
+            {
+                factory.addLink({linkId++, 1, {ramp, sd::NodeType::RAMP}, {worker, sd::NodeType::WORKER}});
+            }
+        }
+        for (size_t worker = 1; worker <= layers * layerWidth; ++worker)
+        {
+            if (worker > (layers - 1) * layerWidth)
+            {
+                factory.addLink(
+                    {linkId++, 1, {worker, sd::NodeType::WORKER}, {worker % stores + 1, sd::NodeType::STORE}});
+                continue;
+            }
+            for (size_t offset = 0; offset < 3; ++offset)
+            {
+                auto layerBegin = (worker - 1) / layerWidth * layerWidth + layerWidth + 1;
+                auto destination = layerBegin + (worker + offset * 17) % layerWidth;
+                factory.addLink({linkId++, double(offset + 1), {worker, sd::NodeType::WORKER},
+                                 {destination, sd::NodeType::WORKER}});
+            }
+        }
+    }
+
+    ~ParallelSchedulerTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(ParallelSchedulerTest, SameRaportsAsTickEngineTest)
+{
+    auto expected = runRepetableSimulation(&fillExampleFactory, 500, {size_t{7}}, {sd::SimulationEngine::TICK});
+    auto actual =
+        runRepetableSimulation(&fillExampleFactory, 500, {size_t{7}}, {sd::SimulationEngine::PARALLEL, 3});
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(ParallelSchedulerTest, SlowWorkersSameRaportsAsTickEngineTest)
+{
+    auto expected = runRepetableSimulation(&fillSlowFactory, 3000, {size_t{97}}, {sd::SimulationEngine::TICK});
+    auto actual =
+        runRepetableSimulation(&fillSlowFactory, 3000, {size_t{97}}, {sd::SimulationEngine::PARALLEL, 2});
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(ParallelSchedulerTest, WideFactorySameRaportsAsTickEngineTest)
+{
+    auto expected = runRepetableSimulation(&fillWideFactory, 400, {size_t{50}}, {sd::SimulationEngine::TICK});
+
+    for (size_t threads : {1, 2, 5, 8})
+    {
+        auto actual =
+            runRepetableSimulation(&fillWideFactory, 400, {size_t{50}}, {sd::SimulationEngine::PARALLEL, threads});
+
+        EXPECT_EQ(actual, expected) << "threads: " << threads;
+    }
+}
+
+TEST_F(ParallelSchedulerTest, MoreThreadsThanWorkersTest)
+{
+    auto expected = runRepetableSimulation(&fillExampleFactory, 100, {size_t{10}}, {sd::SimulationEngine::TICK});
+    auto actual =
+        runRepetableSimulation(&fillExampleFactory, 100, {size_t{10}}, {sd::SimulationEngine::PARALLEL, 16});
+
+    EXPECT_EQ(actual, expected);
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include <format>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "ParameterSweep.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class ParameterSweepTest : public ::testing::Test
+{
+  protected:
+    ParameterSweepTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    static sd::ParameterSweep createSweep(const std::vector<std::string> &definitions, size_t replicas, uint64_t seed)
+    {
+        sd::Factory factory;
+        fillExampleFactory(factory);
+        std::vector<sd::ParameterSweep::Parameter> parameters;
+        for (auto &definition : definitions)
+        {
+            parameters.push_back(sd::ParameterSweep::Parameter::parse(definition));
+        }
+        return sd::ParameterSweep{factory, std::move(parameters), replicas, seed};
+    }
+
+    ~ParameterSweepTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(ParameterSweepTest, ParseListTest)
+{
+    auto parameter = sd::ParameterSweep::Parameter::parse("link:4=0.5,0.3");
+
+    EXPECT_EQ(parameter.target, sd::ParameterSweep::LINK_PROBABILITY);
+    EXPECT_EQ(parameter.id, 4);
+    EXPECT_EQ(parameter.values, (std::vector<double>{0.5, 0.3}));
+    EXPECT_EQ(parameter.getName(), "link:4");
+}
+
+TEST_F(ParameterSweepTest, ParseRangeTest)
+{
+    auto worker = sd::ParameterSweep::Parameter::parse("worker:22=6:10:2");
+    auto ramp = sd::ParameterSweep::Parameter::parse("ramp:1=0.1:0.3:0.1");
+    auto link = sd::ParameterSweep::Parameter::parse("link:4=0.1:0.5:0.1");
+
+    EXPECT_EQ(worker.target, sd::ParameterSweep::WORKER_PROCESSING_TIME);
+    EXPECT_EQ(worker.values, (std::vector<double>{6, 8, 10}));
+    EXPECT_EQ(ramp.target, sd::ParameterSweep::RAMP_DELIVERY_INTERVAL);
+    EXPECT_EQ(ramp.values.size(), 3);
+    EXPECT_EQ(link.values, (std::vector<double>{0.1, 0.2, 0.3, 0.4, 0.5}));
+}
+
+TEST_F(ParameterSweepTest, ParseInvalidTest)
+{
+    EXPECT_THROW(
+        try { sd::ParameterSweep::Parameter::parse("worker22=1"); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Sweep parameter: \"worker22=1\", expected to fit this pattern: "
+                         "<worker|ramp|link>:<id>=<values>",
+                         e.what());
+            throw;
+        },
+        std::runtime_error);
+    EXPECT_THROW(sd::ParameterSweep::Parameter::parse("store:1=1"), std::runtime_error);
+    EXPECT_THROW(sd::ParameterSweep::Parameter::parse("worker:1=5:1:1"), std::runtime_error);
+}
+
+TEST_F(ParameterSweepTest, ParseNotNumberTest)
+{
+    for (std::string definition : {"worker:1=abc", "worker:1=1:x:1", "worker:x=1", "link:1=0.5,1e999"})
+    {
+        EXPECT_THROW(
+            try { sd::ParameterSweep::Parameter::parse(definition); } catch (const std::runtime_error &e) {
+                EXPECT_EQ(std::format("Sweep parameter: \"{}\", expected to fit this pattern: "
+                                      "<worker|ramp|link>:<id>=<values>",
+                                      definition),
+                          e.what());
+                throw;
+            },
+            std::runtime_error);
+    }
+}
+
+TEST_F(ParameterSweepTest, VariantsGridTest)
+{
+    auto sweep = createSweep({"worker:22=6:10:2", "link:4=0.5,0.3"}, 1, 0);
+
+    EXPECT_EQ(sweep.getVariantsCount(), 6);
+    EXPECT_EQ(sweep.getVariantValues(0), (std::vector<double>{6, 0.5}));
+    EXPECT_EQ(sweep.getVariantValues(3), (std::vector<double>{8, 0.3}));
+    EXPECT_EQ(sweep.getVariantValues(5), (std::vector<double>{10, 0.3}));
+
+    auto variant = sweep.createVariant(3);
+    sd::Factory factory{variant};
+    for (auto &worker : factory.getWorkersData())
+    {
+        if (worker.id == 22)
+        {
+            EXPECT_EQ(worker.processingTime, 8);
+        }
+    }
+    for (auto &link : factory.getLinksData())
+    {
+        if (link.id == 4)
+        {
+            EXPECT_EQ(link.probability, 0.3);
+        }
+    }
+}
+
+TEST_F(ParameterSweepTest, UnknownNodeTest)
+{
+    EXPECT_THROW(
+        try { createSweep({"worker:99=1,2"}, 1, 0); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Could not find Worker of id 99 to be swept.", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(ParameterSweepTest, NotPositiveValueTest)
+{
+    auto expectError = [](const std::string &parameter, const char *message) {
+        EXPECT_THROW(
+            try { createSweep({parameter}, 1, 0); } catch (const std::runtime_error &e) {
+                EXPECT_STREQ(message, e.what());
+                throw;
+            },
+            std::runtime_error);
+    };
+
+    expectError("worker:1=0,2", "Sweep value 0 of worker:1 must be positive integer.");
+    expectError("ramp:1=0", "Sweep value 0 of ramp:1 must be positive integer.");
+    expectError("link:4=0,0.5", "Sweep value 0 of link:4 must be positive.");
+}
+
+TEST_F(ParameterSweepTest, SameAsReplicaRunTest)
+{
+    auto sweep = createSweep({"worker:1=2,3"}, 1, 17);
+    sweep.run(200, {sd::SimulationEngine::TICK, 2});
+
+    auto expected = sd::ReplicationRunner::runReplica(sweep.createVariant(1), 17, 0, 200, {});
+    double stored = 0;
+    for (auto count : expected.storeHouseCounts)
+    {
+        stored += static_cast<double>(count);
+    }
+
+    auto &result = sweep.getResults()[1];
+    EXPECT_EQ(result.values, (std::vector<double>{3}));
+    EXPECT_EQ(result.throughput.mean, expected.throughput);
+    EXPECT_EQ(result.storedProducts, stored);
+}
+
+TEST_F(ParameterSweepTest, SameTableForAnyThreadsCountTest)
+{
+    auto serial = createSweep({"worker:22=1:3:1", "ramp:2=2,4"}, 2, 3);
+    serial.run(150, {sd::SimulationEngine::TICK, 1});
+    auto parallel = createSweep({"worker:22=1:3:1", "ramp:2=2,4"}, 2, 3);
+    parallel.run(150, {sd::SimulationEngine::EVENT, 4});
+
+    EXPECT_EQ(serial.generateResultsTable(), parallel.generateResultsTable());
+    EXPECT_TRUE(serial.generateResultsTable().starts_with("========= Parameter Sweep =========\nVariants: 6\n"));
+}
\ No newline at end of file
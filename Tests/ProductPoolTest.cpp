@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <iostream>
+
+
+#include "ProductPool.hpp"
+#include "StoreHouse.hpp"
+
+class ProductPoolTest : public ::testing::Test
+{
+  protected:
+    ProductPoolTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~ProductPoolTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(ProductPoolTest, CreateTest)
+{
+    sd::ProductPool pool;
+
+    auto product = pool.create(42);
+
+    EXPECT_EQ(product->getId(), 42);
+    EXPECT_EQ(product->toString(), "#42");
+    EXPECT_EQ(pool.getLiveCount(), 1);
+}
+
+TEST_F(ProductPoolTest, PointerSizeTest)
+{
+    EXPECT_EQ(sizeof(sd::Product::Ptr), sizeof(sd::Product *));
+}
+
+TEST_F(ProductPoolTest, RecycleTest)
+{
+    sd::ProductPool pool;
+
+    auto product = pool.create(1);
+    auto address = product.get();
+    product.reset();
+
+    EXPECT_EQ(pool.getLiveCount(), 0);
+
+    auto recycled = pool.create(2);
+
+    EXPECT_EQ(recycled.get(), address);
+    EXPECT_EQ(recycled->getId(), 2);
+    EXPECT_EQ(pool.getLiveCount(), 1);
+}
+
+TEST_F(ProductPoolTest, SlabGrowthTest)
+{
+    sd::ProductPool pool;
+    std::vector<sd::Product::Ptr> products;
+
+    for (size_t id = 0; id < 3000; ++id)
+    {
+        products.push_back(pool.create(id));
+    }
+    auto capacity = pool.getCapacity();
+
+    EXPECT_GE(capacity, 3000);
+    EXPECT_EQ(pool.getLiveCount(), 3000);
+
+    products.clear();
+    for (size_t id = 0; id < 3000; ++id)
+    {
+        products.push_back(pool.create(id));
+    }
+
+    EXPECT_EQ(pool.getCapacity(), capacity);
+}
+
+TEST_F(ProductPoolTest, HeapProductTest)
+{
+    auto storeHouse = std::make_unique<sd::StoreHouse>(1);
+    sd::ProductPool pool;
+
+    storeHouse->addProductToStore(std::make_unique<sd::Product>(3));
+    storeHouse->addProductToStore(pool.create(4));
+
+    EXPECT_EQ(storeHouse->getStateRaport(0), "STOREHOUSE #1\n\tQueue: #3, #4");
+    EXPECT_EQ(storeHouse->getStoredProduct(true)->getId(), 3);
+    EXPECT_EQ(storeHouse->getStoredProduct(true)->getId(), 4);
+    EXPECT_EQ(pool.getLiveCount(), 0);
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include <format>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <limits>
 #include <memory>
 
 
@@ -46,3 +47,31 @@ TEST_F(ProductTest, ToStringTest)
 
     EXPECT_EQ(p1->toString(), std::format("#{}", p1->getId()));
 }
+
+TEST_F(ProductTest, LatencyTimesTest)
+{
+    sd::Product product{1};
+    product.setCreationTime(100);
+
+    product.setEnqueueTime(107);
+    product.addServiceTime(3);
+    product.addServiceTime(4);
+
+    EXPECT_EQ(product.getEnqueueTime(), 107);
+    EXPECT_EQ(product.getServiceTime(), 7);
+    EXPECT_EQ(sizeof(sd::Product), 32);
+}
+
+TEST_F(ProductTest, LatencyTimesSaturateTest)
+{
+    constexpr size_t maxOffset = std::numeric_limits<uint32_t>::max();
+    sd::Product product{1};
+    product.setCreationTime(10);
+
+    product.setEnqueueTime(10 + maxOffset + 5);
+    product.addServiceTime(maxOffset);
+    product.addServiceTime(1);
+
+    EXPECT_EQ(product.getEnqueueTime(), 10 + maxOffset);
+    EXPECT_EQ(product.getServiceTime(), maxOffset);
+}
\ No newline at end of file
@@ -0,0 +1,267 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "BinaryRaportSink.hpp"
+#include "Factory.hpp"
+#include "NullRaportSink.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+#include "TextRaportSink.hpp"
+
+class RaportSinkTest : public ::testing::Test
+{
+  protected:
+    RaportSinkTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~RaportSinkTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    struct CountingSink : sd::IRaportSink
+    {
+        size_t nodes = 0;
+        size_t links = 0;
+        size_t products = 0;
+        size_t raports = 0;
+
+        void beginRaport(size_t, bool) final
+        {
+            ++raports;
+        }
+
+        void beginSection(std::string_view) final
+        {
+        }
+
+        void beginNode(size_t, sd::NodeType, size_t) final
+        {
+            ++nodes;
+        }
+
+        void writeProperty(size_t, std::string_view, size_t) final
+        {
+        }
+
+        void writeProperty(size_t, std::string_view, std::string_view) final
+        {
+        }
+
+        void beginLinks(size_t) final
+        {
+        }
+
+        void writeLink(size_t, sd::NodeType, size_t, double) final
+        {
+            ++links;
+        }
+
+        void beginQueue(size_t) final
+        {
+        }
+
+        void writeCurrentProduct(uint64_t, size_t) final
+        {
+            ++products;
+        }
+
+        void writeProduct(uint64_t) final
+        {
+            ++products;
+        }
+
+        void writeQueueSummary(size_t, const sd::QueueSummary &, size_t) final
+        {
+        }
+
+        void endNode() final
+        {
+        }
+
+        void beginLatencyRaport() final
+        {
+        }
+
+        void writeLatency(size_t, std::string_view, const sd::LatencyStatistic &) final
+        {
+        }
+    };
+
+    sd::Factory::Ptr createRunFactory()
+    {
+        resetRepetableSimulation();
+        auto factory = std::make_unique<sd::Factory>();
+        fillExampleFactory(*factory);
+        std::stringstream out;
+        factory->run(300, out, {size_t{0}});
+        return factory;
+    }
+
+    sd::RunOptions sinkOptions(sd::RaportMode raportMode, size_t pendingRaports, sd::IRaportSink *sink)
+    {
+        sd::RunOptions options;
+        options.structureRaport = false;
+        options.raportMode = raportMode;
+        options.summaryProductsLimit = 3;
+        options.pendingRaports = pendingRaports;
+        options.raportSink = sink;
+        return options;
+    }
+} // namespace
+
+TEST_F(RaportSinkTest, TextSinkReusesBufferTest)
+{
+    auto factory = createRunFactory();
+    auto expected = factory->generateStateRaport();
+
+    std::string buffer;
+    sd::TextRaportSink sink{buffer};
+    factory->writeStateRaport(sink);
+    EXPECT_EQ(buffer, expected);
+
+    auto capacity = buffer.capacity();
+    buffer.clear();
+    factory->writeStateRaport(sink);
+    EXPECT_EQ(buffer, expected);
+    EXPECT_EQ(buffer.capacity(), capacity);
+}
+
+TEST_F(RaportSinkTest, NodeRaportTest)
+{
+    auto worker = std::make_unique<sd::Worker>(1, sd::WorkerType::LIFO, 3, 5);
+    auto storeHouse = std::make_unique<sd::StoreHouse>(2, 4);
+    sd::Link link{1, 1, *worker, *storeHouse};
+    worker->bindSourceLink(link);
+    storeHouse->bindDestinationLink(link);
+
+    std::string buffer;
+    sd::TextRaportSink sink{buffer};
+    worker->writeStructureRaport(sink, 1);
+
+    EXPECT_EQ(buffer, "\tWORKER #1\n\t\tProcessing time: 3\n\t\tQueue type: LIFO\n\t\tQueue capacity: 5\n"
+                      "\t\tReceivers:\n\t\t\tSTOREHOUSE #2 (p = 1.00)");
+    EXPECT_EQ(storeHouse->getStructureRaport(0), "STOREHOUSE #2\n\tQueue capacity: 4");
+}
+
+TEST_F(RaportSinkTest, BinarySinkReplayTest)
+{
+    auto factory = createRunFactory();
+
+    std::vector<uint8_t> buffer;
+    sd::BinaryRaportSink sink{buffer};
+    factory->writeStructureRaport(sink);
+    factory->writeStateRaport(sink);
+
+    std::string replayed;
+    sd::TextRaportSink textSink{replayed};
+    sd::BinaryRaportSink::replay(buffer, textSink);
+
+    EXPECT_EQ(replayed, factory->generateStructureRaport() + factory->generateStateRaport());
+    EXPECT_LT(buffer.size(), replayed.size());
+}
+
+TEST_F(RaportSinkTest, CustomSinkTest)
+{
+    auto factory = createRunFactory();
+
+    CountingSink sink;
+    factory->writeStructureRaport(sink);
+    EXPECT_EQ(sink.nodes, factory->getLoadingRampsData().size() + factory->getWorkersData().size() +
+                              factory->getStorehousesData().size());
+    EXPECT_EQ(sink.links, factory->getLinksData().size());
+
+    sink = {};
+    factory->writeStateRaport(sink);
+    auto raport = factory->generateStateRaport();
+    EXPECT_EQ(sink.nodes, factory->getWorkersData().size() + factory->getStorehousesData().size());
+    EXPECT_EQ(sink.products, std::count(raport.begin(), raport.end(), '#') - sink.nodes);
+}
+
+TEST_F(RaportSinkTest, RunIntoBinarySinkTest)
+{
+    for (auto raportMode : {sd::RaportMode::FULL, sd::RaportMode::DELTA, sd::RaportMode::SUMMARY})
+    {
+        for (size_t pendingRaports : {0, 4})
+        {
+            auto expected = runRepetableSimulation(&fillSlowFactory, 500, {size_t{50}},
+                                                   sinkOptions(raportMode, pendingRaports, nullptr));
+
+            std::vector<uint8_t> buffer;
+            sd::BinaryRaportSink sink{buffer};
+            auto out = runRepetableSimulation(&fillSlowFactory, 500, {size_t{50}},
+                                              sinkOptions(raportMode, pendingRaports, &sink));
+            EXPECT_TRUE(out.empty());
+
+            std::string replayed;
+            sd::TextRaportSink textSink{replayed};
+            sd::BinaryRaportSink::replay(buffer, textSink);
+            EXPECT_EQ(replayed, expected);
+        }
+    }
+}
+
+TEST_F(RaportSinkTest, RunIntoCustomSinkTest)
+{
+    CountingSink sink;
+    auto options = sinkOptions(sd::RaportMode::FULL, 4, &sink);
+    options.structureRaport = true;
+    runRepetableSimulation(&fillSlowFactory, 500, {size_t{50}}, options);
+
+    EXPECT_EQ(sink.raports, 10);
+
+    options.engine = sd::SimulationEngine::FLAT;
+    EXPECT_THROW(
+        try { runRepetableSimulation(&fillSlowFactory, 500, {size_t{50}}, options); } catch (
+            const std::runtime_error &e) {
+            EXPECT_STREQ("Flat engine does not support raport sinks", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(RaportSinkTest, NullSinkTest)
+{
+    auto factory = createRunFactory();
+
+    sd::NullRaportSink sink;
+    EXPECT_NO_THROW(factory->writeStructureRaport(sink));
+    EXPECT_NO_THROW(factory->writeStateRaport(sink));
+}
+
+TEST_F(RaportSinkTest, InvalidBinaryRaportTest)
+{
+    std::string out;
+    sd::TextRaportSink sink{out};
+
+    EXPECT_THROW(
+        try { sd::BinaryRaportSink::replay({42}, sink); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Raport contains unknown record 42", e.what());
+            throw;
+        },
+        std::runtime_error);
+    EXPECT_THROW(
+        try { sd::BinaryRaportSink::replay({sd::BinaryRaportSink::SECTION, 5, 'a'}, sink); } catch (
+            const std::runtime_error &e) {
+            EXPECT_STREQ("Raport contains truncated text", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Random.hpp"
+#include "ReplicationRunner.hpp"
+#include "TestHelpers.hpp"
+
+class ReplicationRunnerTest : public ::testing::Test
+{
+  protected:
+    ReplicationRunnerTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    static sd::ReplicationRunner createRunner(size_t replicas, uint64_t seed)
+    {
+        sd::Factory factory;
+        fillExampleFactory(factory);
+        return sd::ReplicationRunner{factory, replicas, seed};
+    }
+
+    static bool equal(const sd::ReplicationRunner::ReplicaResult &lhs,
+                      const sd::ReplicationRunner::ReplicaResult &rhs)
+    {
+        return lhs.workerQueueLengths == rhs.workerQueueLengths && lhs.storeHouseCounts == rhs.storeHouseCounts &&
+               lhs.throughput == rhs.throughput;
+    }
+
+    ~ReplicationRunnerTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(ReplicationRunnerTest, SameResultsForAnyThreadsCountTest)
+{
+    auto serial = createRunner(6, 42);
+    serial.run(300, {sd::SimulationEngine::TICK, 1});
+    auto parallel = createRunner(6, 42);
+    parallel.run(300, {sd::SimulationEngine::TICK, 4});
+
+    ASSERT_EQ(serial.getResults().size(), 6);
+    ASSERT_EQ(parallel.getResults().size(), 6);
+    for (size_t replica = 0; replica < 6; ++replica)
+    {
+        EXPECT_TRUE(equal(serial.getResults()[replica], parallel.getResults()[replica])) << "replica: " << replica;
+    }
+    EXPECT_EQ(serial.generateStatisticsRaport(), parallel.generateStatisticsRaport());
+}
+
+TEST_F(ReplicationRunnerTest, ReplicasUseIndependentStreamsTest)
+{
+    auto runner = createRunner(4, 7);
+    runner.run(500, {sd::SimulationEngine::EVENT, 2});
+
+    auto &results = runner.getResults();
+    EXPECT_FALSE(equal(results[0], results[1]) && equal(results[1], results[2]) && equal(results[2], results[3]));
+}
+
+TEST_F(ReplicationRunnerTest, ReplicaMatchesSingleRunTest)
+{
+    auto runner = createRunner(3, 11);
+    runner.run(250, {sd::SimulationEngine::TICK, 3});
+
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    factory.setContext(sd::ReplicationRunner::createReplicaContext(11, 2));
+    std::stringstream out;
+    factory.run(250, out, {size_t{0}});
+
+    auto expected = sd::ReplicationRunner::collectResult(factory, 250);
+    EXPECT_TRUE(equal(runner.getResults()[2], expected));
+}
+
+TEST_F(ReplicationRunnerTest, GlobalStateUntouchedTest)
+{
+    auto idSeed = sd::Product::getIdSeed();
+
+    auto runner = createRunner(3, 5);
+    runner.run(100, {sd::SimulationEngine::TICK, 2});
+
+    EXPECT_EQ(sd::Product::getIdSeed(), idSeed);
+}
+
+TEST_F(ReplicationRunnerTest, StatisticTest)
+{
+    auto statistic = sd::ReplicationRunner::computeStatistic({1, 2, 3, 4});
+    auto halfWidth = 3.182 * std::sqrt(5.0 / 3.0 / 4.0);
+
+    EXPECT_DOUBLE_EQ(statistic.mean, 2.5);
+    EXPECT_DOUBLE_EQ(statistic.variance, 5.0 / 3.0);
+    EXPECT_DOUBLE_EQ(statistic.confidenceLow, 2.5 - halfWidth);
+    EXPECT_DOUBLE_EQ(statistic.confidenceHigh, 2.5 + halfWidth);
+
+    auto single = sd::ReplicationRunner::computeStatistic({3});
+    EXPECT_DOUBLE_EQ(single.mean, 3);
+    EXPECT_DOUBLE_EQ(single.variance, 0);
+    EXPECT_DOUBLE_EQ(single.confidenceLow, 3);
+}
+
+TEST_F(ReplicationRunnerTest, StatisticsRaportTest)
+{
+    auto runner = createRunner(2, 1);
+    runner.run(50, {sd::SimulationEngine::TICK, 2});
+
+    auto raport = runner.generateStatisticsRaport();
+
+    EXPECT_TRUE(raport.starts_with("========= Replication Statistics =========\n"
+                                   "Replicas: 2\nIterations: 50\nSeed: 1\n"));
+    EXPECT_NE(raport.find("WORKER #22\n\tQueue length: mean = "), std::string::npos);
+    EXPECT_NE(raport.find("STOREHOUSE #1\n\tProducts: mean = "), std::string::npos);
+    EXPECT_NE(raport.find("== THROUGHPUT ==\n\n\tProducts per iteration: mean = "), std::string::npos);
+}
+
+TEST_F(ReplicationRunnerTest, FlatEngineMatchesTickTest)
+{
+    auto idSeed = sd::Product::getIdSeed();
+
+    auto tick = createRunner(4, 9);
+    tick.run(300, {sd::SimulationEngine::TICK, 2});
+    auto flat = createRunner(4, 9);
+    flat.run(300, {sd::SimulationEngine::FLAT, 2});
+
+    for (size_t replica = 0; replica < 4; ++replica)
+    {
+        EXPECT_TRUE(equal(flat.getResults()[replica], tick.getResults()[replica])) << "replica: " << replica;
+    }
+    EXPECT_EQ(flat.generateStatisticsRaport(), tick.generateStatisticsRaport());
+    EXPECT_EQ(sd::Product::getIdSeed(), idSeed);
+}
+
+TEST_F(ReplicationRunnerTest, CheckpointNotSupportedTest)
+{
+    auto runner = createRunner(4, 1);
+    sd::RunOptions options{sd::SimulationEngine::TICK, 1};
+    options.checkpointFile = "replicas.bin";
+    options.checkpointInterval = 10;
+
+    EXPECT_THROW(
+        try { runner.run(100, options); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Checkpoints cannot be used for replications", e.what());
+            throw;
+        },
+        std::runtime_error);
+    EXPECT_FALSE(std::filesystem::exists("replicas.bin"));
+
+    options.checkpointFile = std::nullopt;
+    options.startTime = 50;
+    EXPECT_THROW(runner.run(100, options), std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+
+#include "Random.hpp"
+#include "StaticFactory.hpp"
+#include "TestHelpers.hpp"
+
+namespace
+{
+    constexpr sd::StaticStructure<2, 3, 1, 8> exampleStructure{
+        {{{1, 3}, {2, 2}}},
+        {{{1, 2, sd::WorkerType::FIFO}, {2, 1, sd::WorkerType::FIFO}, {22, 10, sd::WorkerType::FIFO}}},
+        {{{1}}},
+        {{{1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}},
+          {2, 0.3, {2, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}},
+          {3, 0.7, {2, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}},
+          {4, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}},
+          {5, 0.5, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}},
+          {6, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}},
+          {7, 1, {22, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}},
+          {8, 1, {1, sd::NodeType::RAMP}, {22, sd::NodeType::WORKER}}}}};
+
+    constexpr sd::StaticStructure<3, 4, 2, 11> slowStructure{
+        {{{3, 40}, {1, 1}, {2, 0}}},
+        {{{4, 7, sd::WorkerType::LIFO},
+          {1, 3, sd::WorkerType::LIFO},
+          {2, 0, sd::WorkerType::FIFO},
+          {3, 250, sd::WorkerType::FIFO}}},
+        {{{2}, {1}}},
+        {{{1, 0.4, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}},
+          {2, 0.6, {1, sd::NodeType::RAMP}, {4, sd::NodeType::WORKER}},
+          {3, 1, {2, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}},
+          {4, 1, {3, sd::NodeType::RAMP}, {3, sd::NodeType::WORKER}},
+          {5, 0.2, {1, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}},
+          {6, 0.8, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}},
+          {7, 0.5, {2, sd::NodeType::WORKER}, {3, sd::NodeType::WORKER}},
+          {8, 0.5, {2, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}},
+          {9, 1, {3, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}},
+          {10, 0.9, {4, sd::NodeType::WORKER}, {4, sd::NodeType::WORKER}},
+          {11, 0.1, {4, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}}}};
+
+    constexpr sd::StaticStructure<1, 1, 1, 2> rampToStoreStructure{
+        {{{1, 1}}},
+        {{{1, 1, sd::WorkerType::FIFO}}},
+        {{{1}}},
+        {{{1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}},
+          {2, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::STORE}}}}};
+
+    constexpr sd::StaticStructure<1, 1, 0, 1> unconnectedWorkerStructure{
+        {{{1, 1}}},
+        {{{1, 1, sd::WorkerType::FIFO}}},
+        {},
+        {{{1, 0.5, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}}}}};
+
+    constexpr sd::StaticStructure<1, 1, 1, 2> chainStructure{
+        {{{1, 1}}},
+        {{{1, 1, sd::WorkerType::FIFO}}},
+        {{{1}}},
+        {{{1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}},
+          {2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}}}}};
+
+    void fillChainFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 1});
+        factory.addWorker({1, 1, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    }
+
+    static_assert(sd::checkStaticStructure(exampleStructure).valid());
+    static_assert(sd::checkStaticStructure(rampToStoreStructure).rule == sd::StaticStructureRule::RAMP_TO_STOREHOUSE);
+} // namespace
+
+class StaticFactoryTest : public ::testing::Test
+{
+  protected:
+    StaticFactoryTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~StaticFactoryTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(StaticFactoryTest, SameRaportsAsFactoryTest)
+{
+    resetRepetableSimulation();
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream expected;
+    factory.run(500, expected, {size_t{7}});
+    auto expectedIdSeed = sd::Product::getIdSeed();
+
+    resetRepetableSimulation();
+    sd::StaticFactory<exampleStructure> staticFactory;
+    std::stringstream actual;
+    staticFactory.run(500, actual, {size_t{7}}, sd::Random::get());
+
+    EXPECT_EQ(actual.str(), expected.str());
+    EXPECT_EQ(sd::Product::getIdSeed(), expectedIdSeed);
+}
+
+TEST_F(StaticFactoryTest, UnorderedSlowStructureSameRaportsAsFactoryTest)
+{
+    auto expected = runRepetableSimulation(&fillSlowFactory, 3000, {size_t{97}}, {sd::SimulationEngine::TICK});
+
+    resetRepetableSimulation();
+    auto staticFactory = std::make_unique<sd::StaticFactory<slowStructure, 4096>>();
+    std::stringstream actual;
+    staticFactory->run(3000, actual, {size_t{97}}, sd::Random::get());
+
+    EXPECT_EQ(actual.str(), expected);
+}
+
+TEST_F(StaticFactoryTest, ResetTest)
+{
+    resetRepetableSimulation();
+    sd::StaticFactory<exampleStructure> staticFactory;
+    std::stringstream out;
+    staticFactory.run(50, out, {size_t{0}}, sd::Random::get());
+
+    staticFactory.reset();
+
+    EXPECT_EQ(staticFactory.generateStateRaport(), "== WORKERS ==\n\nWORKER #1\n\tQueue: \n\nWORKER #2\n\tQueue: \n\n"
+                                                   "WORKER #22\n\tQueue: \n\n== STOREHOUSES ==\n\n"
+                                                   "STOREHOUSE #1\n\tQueue: \n\n");
+}
+
+TEST_F(StaticFactoryTest, StoreHousesOutgrowQueueCapacityTest)
+{
+    auto expected = runRepetableSimulation(&fillChainFactory, 5000, {std::vector<size_t>{4999}}, {});
+
+    resetRepetableSimulation();
+    sd::StaticFactory<chainStructure, 4> staticFactory;
+    std::stringstream actual;
+    staticFactory.run(5000, actual, {std::vector<size_t>{4999}}, sd::Random::get());
+
+    EXPECT_EQ(actual.str(), expected);
+    auto raport = actual.str();
+    EXPECT_GT(std::count(raport.begin(), raport.end(), '#'), 4000);
+}
+
+TEST_F(StaticFactoryTest, QueuesOutgrowQueueCapacityTest)
+{
+    auto expected = runRepetableSimulation(&fillSlowFactory, 3000, {size_t{97}}, {sd::SimulationEngine::TICK});
+
+    resetRepetableSimulation();
+    sd::StaticFactory<slowStructure, 4> staticFactory;
+    std::stringstream actual;
+    staticFactory.run(3000, actual, {size_t{97}}, sd::Random::get());
+
+    EXPECT_EQ(actual.str(), expected);
+}
+
+TEST_F(StaticFactoryTest, StructureErrorTest)
+{
+    constexpr auto error = sd::checkStaticStructure(unconnectedWorkerStructure);
+
+    EXPECT_EQ(error.rule, sd::StaticStructureRule::WORKER_NOT_SOURCE);
+    EXPECT_EQ(error.toString(), "Worker of id 1 is not connected as source.");
+    EXPECT_EQ(sd::checkStaticStructure(rampToStoreStructure).toString(), "Cannot bind Ramp and Store.");
+}
\ No newline at end of file
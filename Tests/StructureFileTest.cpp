@@ -0,0 +1,168 @@
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "Random.hpp"
+#include "StructureFile.hpp"
+#include "TestHelpers.hpp"
+
+class StructureFileTest : public ::testing::Test
+{
+  protected:
+    const std::string binaryFile = "structureFileTest.sdfs";
+    const std::string textFile = "structureFileTest.txt";
+
+    StructureFileTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(binaryFile);
+        std::filesystem::remove(textFile);
+    }
+
+    ~StructureFileTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+
+    void expectSameStructure(const sd::Factory &factory, const sd::Factory &expected)
+    {
+        EXPECT_TRUE(cmp(factory.getLoadingRampsData(), expected.getLoadingRampsData()));
+        EXPECT_TRUE(cmp(factory.getWorkersData(), expected.getWorkersData()));
+        EXPECT_TRUE(cmp(factory.getStorehousesData(), expected.getStorehousesData()));
+        EXPECT_TRUE(cmp(factory.getLinksData(), expected.getLinksData()));
+        EXPECT_EQ(factory.generateStructureRaport(), expected.generateStructureRaport());
+    }
+
+    void expectReadError(const std::string &data, const std::string &message)
+    {
+        std::stringstream in{data};
+        EXPECT_THROW(
+            try { sd::StructureFile::read(in); } catch (const std::runtime_error &e) {
+                EXPECT_EQ(message, e.what());
+                throw;
+            },
+            std::runtime_error);
+    }
+};
+
+TEST_F(StructureFileTest, SaveBinaryTest)
+{
+    sd::Factory expected;
+    fillExampleFactory(expected);
+    expected.addWorker({4, 2, sd::WorkerType::LIFO, 5});
+    expected.addStorehouse({3, 7});
+    sd::StructureFile::save(expected, binaryFile);
+
+    sd::Factory factory;
+    sd::StructureFile::load(factory, binaryFile);
+
+    EXPECT_TRUE(sd::StructureFile::isBinary(binaryFile));
+    expectSameStructure(factory, expected);
+}
+
+TEST_F(StructureFileTest, SaveTextTest)
+{
+    sd::Factory expected;
+    fillExampleFactory(expected);
+    sd::StructureFile::save(expected, textFile);
+
+    sd::Factory factory;
+    sd::StructureFile::load(factory, textFile);
+
+    EXPECT_FALSE(sd::StructureFile::isBinary(textFile));
+    expectSameStructure(factory, expected);
+}
+
+TEST_F(StructureFileTest, LoadByMagicNumberTest)
+{
+    sd::Factory expected;
+    fillSlowFactory(expected);
+    {
+        std::ofstream file{textFile, std::ios::binary};
+        sd::StructureFile::write(file, expected.getStructure());
+    }
+
+    sd::Factory factory;
+    sd::StructureFile::load(factory, textFile);
+
+    expectSameStructure(factory, expected);
+}
+
+TEST_F(StructureFileTest, BulkInsertMatchesSequentialTest)
+{
+    sd::Factory expected;
+    fillExampleFactory(expected);
+
+    sd::Factory factory{expected.getStructure()};
+
+    expectSameStructure(factory, expected);
+    EXPECT_EQ(runRepetableSimulation(&fillExampleFactory, 200, {size_t{10}}, {}),
+              runRepetableSimulation(
+                  [](sd::Factory &factory) {
+                      sd::Factory example;
+                      fillExampleFactory(example);
+                      factory.addStructure(example.getStructure());
+                  },
+                  200, {size_t{10}}, {}));
+}
+
+TEST_F(StructureFileTest, BulkInsertErrorsTest)
+{
+    sd::FactoryStructure structure;
+    structure.workers = {{1, 1, sd::WorkerType::FIFO}, {1, 2, sd::WorkerType::LIFO}};
+
+    EXPECT_THROW(
+        try { sd::Factory{structure}; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Worker of id 1 was already created.", e.what());
+            throw;
+        },
+        std::runtime_error);
+
+    structure.workers.pop_back();
+    structure.links = {{1, 1, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}}};
+    EXPECT_THROW(
+        try { sd::Factory{structure}; } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Could not find Worker of id 2 to be link destination.", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(StructureFileTest, ReadErrorsTest)
+{
+    sd::Factory factory;
+    fillExampleFactory(factory);
+    std::stringstream out;
+    sd::StructureFile::write(out, factory.getStructure());
+    auto data = out.str();
+
+    expectReadError("LOADING_RAMP id=1 delivery-interval=3", "Structure file has invalid header");
+    expectReadError(std::string{"SDFS\x02", 5}, "Unsupported structure file version 2");
+    expectReadError(data.substr(0, 9), "Structure file is corrupted");
+    expectReadError(data.substr(0, data.size() - 1), "Structure file is corrupted");
+
+    auto oversized = data;
+    std::fill_n(oversized.begin() + 5, sizeof(uint64_t), '\xff');
+    expectReadError(oversized, "Structure file is corrupted");
+    expectReadError(data.substr(0, 5) + std::string(sizeof(uint64_t), '\x7f'), "Structure file is corrupted");
+
+    sd::FactoryStructure structure;
+    structure.links = {{1, 1, {1, sd::NodeType::RAMP}, {1, static_cast<sd::NodeType>(7)}}};
+    std::stringstream corrupted;
+    sd::StructureFile::write(corrupted, structure);
+    expectReadError(corrupted.str(), "Structure file is corrupted");
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "MappedFile.hpp"
+#include "Random.hpp"
+#include "StructureParser.hpp"
+#include "TestHelpers.hpp"
+#include "Utils.hpp"
+
+class StructureParserTest : public ::testing::Test
+{
+  protected:
+    const std::string structureFile = "structureParserTest.txt";
+
+    StructureParserTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(structureFile);
+    }
+
+    ~StructureParserTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+
+    void writeStructureFile(const std::string &text)
+    {
+        std::ofstream file{structureFile, std::ios::binary};
+        file << text;
+    }
+
+    void expectError(const std::string &text, const std::string &message)
+    {
+        sd::Factory factory;
+        EXPECT_THROW(
+            try { sd::StructureParser{factory}.parse(text); } catch (const std::runtime_error &e) {
+                EXPECT_EQ(message, e.what());
+                throw;
+            },
+            std::runtime_error);
+    }
+};
+
+TEST_F(StructureParserTest, ParseFileTest)
+{
+    sd::Factory expected;
+    fillExampleFactory(expected);
+    std::stringstream structure;
+    structure << expected;
+    writeStructureFile(structure.str());
+
+    sd::Factory factory;
+    sd::StructureParser{factory}.parseFile(structureFile);
+
+    EXPECT_TRUE(cmp(factory.getLoadingRampsData(), expected.getLoadingRampsData()));
+    EXPECT_TRUE(cmp(factory.getWorkersData(), expected.getWorkersData()));
+    EXPECT_TRUE(cmp(factory.getStorehousesData(), expected.getStorehousesData()));
+    EXPECT_TRUE(cmp(factory.getLinksData(), expected.getLinksData()));
+}
+
+TEST_F(StructureParserTest, ParseEmptyFileTest)
+{
+    writeStructureFile("");
+
+    sd::Factory factory;
+    sd::StructureParser{factory}.parseFile(structureFile);
+
+    EXPECT_FALSE(factory.initialized());
+    EXPECT_EQ(sd::MappedFile{structureFile}.getView(), "");
+}
+
+TEST_F(StructureParserTest, ParseMissingFileTest)
+{
+    sd::Factory factory;
+
+    EXPECT_THROW(
+        try { sd::StructureParser{factory}.parseFile("missingStructure.txt"); } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Could not open file: missingStructure.txt", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
+
+TEST_F(StructureParserTest, ParseNumbersTest)
+{
+    sd::Factory factory;
+    sd::StructureParser{factory}.parse("; comment\n\nLOADING_RAMP id=+1 delivery-interval=3\n"
+                                       "WORKER id=2 processing-time=4 queue-type=LIFO\n"
+                                       "LINK id=1 src=ramp-1 dest=worker-2 p=0x1p-1\n"
+                                       "LINK id=2 src=ramp-1 dest=worker-2 p=.25");
+
+    EXPECT_TRUE(cmp(factory.getLoadingRampsData(), {{1, 3}}));
+    EXPECT_TRUE(cmp(factory.getWorkersData(), {{2, 4, sd::WorkerType::LIFO}}));
+    auto links = factory.getLinksData();
+    ASSERT_EQ(links.size(), 2);
+    EXPECT_EQ(links[0].probability, 0.5);
+    EXPECT_EQ(links[1].probability, 0.25);
+}
+
+TEST_F(StructureParserTest, ParseErrorsTest)
+{
+    expectError("\n; comment\nRAMP id=1", "Error in line 2: Expected word: WORKER | LOADING_RAMP | STOREHOUSE | LINK");
+    expectError("STOREHOUSE id=1 capacity=0",
+                "Error in line 0: Sentence: \"capacity=0\", expected to fit this pattern: capacity=<capacity>, where "
+                "<capacity> is number grather than zero");
+    expectError("STOREHOUSE id=1 id=2", "Error in line 0: This option was already provided: id=2");
+    expectError("WORKER id=1 processing-time=2 queue-type=FIFA",
+                "Error in line 0: Sentence: \"queue-type=FIFA\", expected to fit this pattern: queue-type=<queuetype>");
+    expectError("WORKER id=1 processing-time=2 capacity=3",
+                "Error in line 0: This option was not provided: queue-type");
+    expectError("LOADING_RAMP id=1 delivery-interval=x", "Error in line 0: stoi");
+    expectError("LOADING_RAMP id=1 delivery-interval=99999999999", "Error in line 0: stoi");
+    expectError("STOREHOUSE id=99999999999999999999", "Error in line 0: stoull");
+    expectError("STOREHOUSE id==1",
+                "Error in line 0: Sentence: \"id==1\", expected to fit this pattern: id=<id>, where <id> is "
+                "idenfificator number grather than zero");
+    expectError("LINK id=1 src=belt-1 dest=store-1 p=1",
+                "Error in line 0: Sentence: \"src=belt-1\", expected to fit this pattern: src=type-id, where type is "
+                "one of ramp, worker and id is identifier");
+    expectError("LINK id=1 src=ramp-1 dest=store-1 p=1e-400", "Error in line 0: stod");
+    expectError("LINK id=1 src=ramp-1 dest=store-1",
+                "Error in line 0: Expected this line to fit this pattern: LINK id=<id> src=<type>-<id> "
+                "dest=<type>-<id> p=<probability>, where id is unique indentificator, <type> is one of following: "
+                "ramp/worker/store and <probability> is in range <0:1>");
+}
+
+TEST_F(StructureParserTest, StreamOperatorTest)
+{
+    std::stringstream in{"STOREHOUSE id=3\nSTOREHOUSE id=4 capacity=5\n"};
+    sd::Factory factory;
+    in >> factory;
+
+    EXPECT_TRUE(cmp(factory.getStorehousesData(), {{3}, {4, 5}}));
+}
+
+TEST_F(StructureParserTest, ParseChunksInParallelTest)
+{
+    sd::Factory expected;
+    fillExampleFactory(expected);
+    std::stringstream structure;
+    structure << expected;
+
+    std::string text;
+    for (std::string line; std::getline(structure, line);)
+    {
+        text += line + "\n;" + std::string(size_t{1} << 19, '=') + "\n";
+    }
+
+    sd::Factory sequential, parallel;
+    sd::StructureParser{sequential, 1}.parse(text);
+    sd::StructureParser{parallel, 4}.parse(text);
+
+    EXPECT_TRUE(cmp(parallel.getLinksData(), expected.getLinksData()));
+    EXPECT_EQ(parallel.generateStructureRaport(), expected.generateStructureRaport());
+    EXPECT_EQ(sequential.generateStructureRaport(), expected.generateStructureRaport());
+}
+
+TEST_F(StructureParserTest, ParallelErrorsTest)
+{
+    const std::string padding = ";" + std::string(size_t{1} << 20, '=') + "\n";
+    const std::vector<std::pair<std::string, std::string>> cases = {
+        {"WORKER id=1 processing-time=1 queue-type=FIFO\n" + padding + "LINK id=1 src=worker-1 dest=store-1 p=1\n" +
+             padding + "STOREHOUSE id=1\n",
+         "Error in line 2: Could not find Storehouse of id 1 to be link destination."},
+        {"LINK id=1 src=ramp-1 dest=worker-1 p=1\n" + padding + "LOADING_RAMP id=1 delivery-interval=1\n",
+         "Error in line 0: Could not find LoadingRamp of id 1 to be link source."},
+        {"STOREHOUSE id=1\n" + padding + "WORKER id=1 processing-time=1 queue-type=FIFO\n" + padding +
+             "STOREHOUSE id=1\n" + padding + "WORKER id=1 processing-time=1 queue-type=FIFO\n",
+         "Error in line 4: Storehouse of id 1 was already created."},
+        {"STOREHOUSE id=1\n" + padding + "STOREHOUSE id=2\n" + padding + "BROKEN\n" + padding + "STOREHOUSE id=2\n",
+         "Error in line 4: Expected word: WORKER | LOADING_RAMP | STOREHOUSE | LINK"},
+        {"STOREHOUSE id=1\n" + padding + "STOREHOUSE id=2\n" + padding + "STOREHOUSE id=2\n" + padding + "BROKEN\n",
+         "Error in line 4: Storehouse of id 2 was already created."},
+    };
+
+    for (auto &[text, message] : cases)
+    {
+        for (size_t threads : {1, 4})
+        {
+            sd::Factory factory;
+            EXPECT_THROW(
+                try { sd::StructureParser(factory, threads).parse(text); } catch (const std::runtime_error &e) {
+                    EXPECT_EQ(message, e.what());
+                    throw;
+                },
+                std::runtime_error);
+        }
+    }
+}
\ No newline at end of file
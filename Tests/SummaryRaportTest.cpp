@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+
+
+#include "Factory.hpp"
+#include "QueueSummary.hpp"
+#include "Random.hpp"
+#include "TestHelpers.hpp"
+
+class SummaryRaportTest : public ::testing::Test
+{
+  protected:
+    SummaryRaportTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~SummaryRaportTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+namespace
+{
+    sd::RunOptions summaryOptions(sd::SimulationEngine engine, size_t productsLimit, size_t pendingRaports = 4)
+    {
+        sd::RunOptions options{engine, 2};
+        options.raportMode = sd::RaportMode::SUMMARY;
+        options.summaryProductsLimit = productsLimit;
+        options.pendingRaports = pendingRaports;
+        return options;
+    }
+
+    void fillChainFactory(sd::Factory &factory)
+    {
+        factory.addLoadingRamp({1, 1});
+        factory.addWorker({1, 3, sd::WorkerType::FIFO});
+        factory.addStorehouse({1});
+        factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+        factory.addLink({2, 1, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    }
+} // namespace
+
+TEST_F(SummaryRaportTest, GrowingQueueTest)
+{
+    auto raport = runRepetableSimulation(&fillChainFactory, 30, {std::vector<size_t>{29}},
+                                         summaryOptions(sd::SimulationEngine::TICK, 3));
+
+    auto state = raport.substr(raport.find("========= Iteration: 29"));
+    EXPECT_EQ(state, "========= Iteration: 29 =========\n== WORKERS ==\n\n"
+                     "WORKER #1\n\tQueue: #10 (pt = 0), #11, #12, #13 (+16 more)\n"
+                     "\tQueue length: 19, oldest: #11, newest: #29\n\tQueue age: p50 = 9, p90 = 17, p99 = 18\n\n"
+                     "== STOREHOUSES ==\n\n"
+                     "STOREHOUSE #1\n\tQueue: #0, #1, #2 (+6 more)\n"
+                     "\tQueue length: 9, oldest: #0, newest: #8\n\tQueue age: p50 = 25, p90 = 29, p99 = 29\n\n");
+}
+
+TEST_F(SummaryRaportTest, EmptyQueueTest)
+{
+    auto raport =
+        runRepetableSimulation(&fillChainFactory, 1, {size_t{1}}, summaryOptions(sd::SimulationEngine::TICK, 0));
+
+    EXPECT_NE(raport.find("WORKER #1\n\tQueue: #0 (pt = 1), \n\tQueue length: 0\n\n"), std::string::npos);
+    EXPECT_NE(raport.find("STOREHOUSE #1\n\tQueue: \n\tQueue length: 0\n\n"), std::string::npos);
+}
+
+TEST_F(SummaryRaportTest, SameSummaryAcrossEnginesTest)
+{
+    auto expected = runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}},
+                                           summaryOptions(sd::SimulationEngine::TICK, 5, 0));
+    for (auto engine : {sd::SimulationEngine::TICK, sd::SimulationEngine::EVENT, sd::SimulationEngine::PARALLEL})
+    {
+        EXPECT_EQ(runRepetableSimulation(&fillSlowFactory, 1500, {size_t{7}}, summaryOptions(engine, 5)), expected);
+    }
+}
+
+TEST_F(SummaryRaportTest, LimitedRaportSizeTest)
+{
+    auto full = runRepetableSimulation(&fillChainFactory, 3000, {size_t{1000}}, {});
+    auto summary = runRepetableSimulation(&fillChainFactory, 3000, {size_t{1000}},
+                                          summaryOptions(sd::SimulationEngine::TICK, 10));
+
+    EXPECT_GT(full.size(), 10 * summary.size());
+    EXPECT_NE(summary.find("\tQueue length: 1333, oldest: #668, newest: #2000\n"), std::string::npos);
+}
+
+TEST_F(SummaryRaportTest, SampledPercentilesTest)
+{
+    auto storeHouse = std::make_unique<sd::StoreHouse>(1);
+    for (size_t time = 0; time < 100000; ++time)
+    {
+        auto product = sd::Product::create(time);
+        product->setCreationTime(time);
+        storeHouse->addProductToStore(std::move(product));
+    }
+
+    auto summary = sd::QueueSummary::create(*storeHouse, 100000);
+
+    EXPECT_EQ(summary.length, 100000);
+    EXPECT_EQ(summary.oldestProduct, 0);
+    EXPECT_EQ(summary.newestProduct, 99999);
+    EXPECT_NEAR(summary.ageP50, 50000, 500);
+    EXPECT_NEAR(summary.ageP90, 90000, 500);
+    EXPECT_NEAR(summary.ageP99, 99000, 500);
+}
+
+TEST_F(SummaryRaportTest, FlatEngineNotSupportedTest)
+{
+    sd::Factory factory;
+    fillChainFactory(factory);
+
+    std::stringstream out;
+    EXPECT_THROW(
+        try {
+            factory.run(10, out, {size_t{1}}, summaryOptions(sd::SimulationEngine::FLAT, 3));
+        } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Flat engine does not support summary raports", e.what());
+            throw;
+        },
+        std::runtime_error);
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <atomic>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <stdexcept>
+
+
+#include "ThreadPool.hpp"
+
+class ThreadPoolTest : public ::testing::Test
+{
+  protected:
+    ThreadPoolTest()
+    {
+    }
+
+    void SetUp() override
+    {
+    }
+
+    void TearDown() override
+    {
+    }
+
+    ~ThreadPoolTest()
+    {
+    }
+
+    static void TearDownTestSuite()
+    {
+    }
+};
+
+TEST_F(ThreadPoolTest, RunOnEveryThreadTest)
+{
+    sd::ThreadPool pool{4};
+    std::vector<size_t> calls(pool.getThreadsCount(), 0);
+
+    for (size_t round = 0; round < 100; ++round)
+    {
+        pool.run([&](size_t thread) { ++calls[thread]; });
+    }
+
+    EXPECT_EQ(pool.getThreadsCount(), 4);
+    EXPECT_EQ(calls, std::vector<size_t>(4, 100));
+}
+
+TEST_F(ThreadPoolTest, SingleThreadTest)
+{
+    sd::ThreadPool pool{0};
+    std::atomic<size_t> calls = 0;
+
+    pool.run([&](size_t thread) {
+        EXPECT_EQ(thread, 0);
+        ++calls;
+    });
+
+    EXPECT_EQ(pool.getThreadsCount(), 1);
+    EXPECT_EQ(calls, 1);
+}
+
+TEST_F(ThreadPoolTest, TaskErrorTest)
+{
+    sd::ThreadPool pool{3};
+    std::atomic<size_t> calls = 0;
+
+    EXPECT_THROW(
+        try {
+            pool.run([](size_t thread) {
+                if (thread == 2)
+                {
+                    throw std::runtime_error("Task Error");
+                }
+            });
+        } catch (const std::runtime_error &e) {
+            EXPECT_STREQ("Task Error", e.what());
+            throw;
+        },
+        std::runtime_error);
+
+    pool.run([&](size_t) { ++calls; });
+    EXPECT_EQ(calls, 3);
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <memory>
 
 
+#include "LatencyTracker.hpp"
 #include "Link.hpp"
 #include "StoreHouse.hpp"
 #include "Worker.hpp"
@@ -68,9 +69,9 @@ TEST_F(WorkerTest, StructureRaportWithLinksTest)
     auto worker3 = std::make_unique<sd::Worker>(1, sd::WorkerType::FIFO, 3);
     auto storeHouse = std::make_unique<sd::StoreHouse>(1);
 
-    auto link1 = std::make_shared<sd::Link>(1, 0.5, *worker1, *worker2);
-    auto link2 = std::make_shared<sd::Link>(1, 0.5, *worker1, *worker3);
-    auto link3 = std::make_shared<sd::Link>(1, 0.5, *worker1, *storeHouse);
+    sd::Link link1{1, 0.5, *worker1, *worker2};
+    sd::Link link2{1, 0.5, *worker1, *worker3};
+    sd::Link link3{1, 0.5, *worker1, *storeHouse};
 
     worker1->bindSourceLink(link1);
     worker1->bindSourceLink(link2);
@@ -126,6 +127,18 @@ TEST_F(WorkerTest, NodeTypeTest)
     EXPECT_EQ(worker->getNodeType(), sd::NodeType::WORKER);
 }
 
+TEST_F(WorkerTest, NodeStateTest)
+{
+    auto worker = std::make_unique<sd::Worker>(4, sd::WorkerType::FIFO, 3);
+    sd::NodeLatency latency;
+    worker->setLatency(nullptr, &latency);
+
+    sd::SourceNode &source = *worker;
+    sd::DestinationNode &destination = *worker;
+    EXPECT_EQ(&source.getState(), &destination.getState());
+    EXPECT_EQ(destination.getState().latency, &latency);
+}
+
 TEST_F(WorkerTest, MoveInProcessTest)
 {
     auto worker = std::make_unique<sd::Worker>(1, sd::WorkerType::FIFO, 3);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <sstream>
+
 inline bool operator==(const sd::LoadingRampData &lhs, const sd::LoadingRampData &rhs)
 {
     return lhs.id == rhs.id && lhs.deliveryInterval == rhs.deliveryInterval;
@@ -7,12 +9,13 @@ inline bool operator==(const sd::LoadingRampData &lhs, const sd::LoadingRampData
 
 inline bool operator==(const sd::WorkerData &lhs, const sd::WorkerData &rhs)
 {
-    return lhs.id == rhs.id && lhs.processingTime == rhs.processingTime && lhs.type == rhs.type;
+    return lhs.id == rhs.id && lhs.processingTime == rhs.processingTime && lhs.type == rhs.type &&
+           lhs.capacity == rhs.capacity;
 }
 
 inline bool operator==(const sd::StoreHouseData &lhs, const sd::StoreHouseData &rhs)
 {
-    return lhs.id == rhs.id;
+    return lhs.id == rhs.id && lhs.capacity == rhs.capacity;
 }
 
 inline bool operator==(const sd::LinkData &lhs, const sd::LinkData &rhs)
@@ -31,6 +34,19 @@ private:
 public:
     RepetableRandomDevice() : _distr(0, 1) {}
     double next() final { return _distr(_eng); }
+
+    std::string saveState() const final
+    {
+        std::ostringstream out;
+        out << _eng << ' ' << _distr;
+        return out.str();
+    }
+
+    void loadState(const std::string &state) final
+    {
+        std::istringstream in(state);
+        in >> _eng >> _distr;
+    }
 };
 
 template <class T>
@@ -48,4 +64,85 @@ inline bool cmp(const std::vector<T> &left, const std::vector<T> &right)
         }
     }
     return true;
+}
+
+inline void resetRepetableSimulation()
+{
+    sd::Random::get().updateRandomDevice(std::make_unique<RepetableRandomDevice>());
+    sd::Product::setIdSeed(0);
+}
+
+inline void fillExampleFactory(sd::Factory &factory)
+{
+    factory.addLoadingRamp({1, 3});
+    factory.addLoadingRamp({2, 2});
+    factory.addWorker({1, 2, sd::WorkerType::FIFO});
+    factory.addWorker({2, 1, sd::WorkerType::FIFO});
+    factory.addWorker({22, 10, sd::WorkerType::FIFO});
+    factory.addStorehouse({1});
+    factory.addLink({1, 1, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    factory.addLink({2, 0.3, {2, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    factory.addLink({3, 0.7, {2, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    factory.addLink({4, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    factory.addLink({5, 0.5, {1, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+    factory.addLink({6, 1, {2, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    factory.addLink({7, 1, {22, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    factory.addLink({8, 1, {1, sd::NodeType::RAMP}, {22, sd::NodeType::WORKER}});
+}
+
+inline void fillSlowFactory(sd::Factory &factory)
+{
+    factory.addLoadingRamp({1, 1});
+    factory.addLoadingRamp({2, 0});
+    factory.addLoadingRamp({3, 40});
+    factory.addWorker({1, 3, sd::WorkerType::LIFO});
+    factory.addWorker({2, 0, sd::WorkerType::FIFO});
+    factory.addWorker({3, 250, sd::WorkerType::FIFO});
+    factory.addWorker({4, 7, sd::WorkerType::LIFO});
+    factory.addStorehouse({1});
+    factory.addStorehouse({2});
+    factory.addLink({1, 0.4, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    factory.addLink({2, 0.6, {1, sd::NodeType::RAMP}, {4, sd::NodeType::WORKER}});
+    factory.addLink({3, 1, {2, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    factory.addLink({4, 1, {3, sd::NodeType::RAMP}, {3, sd::NodeType::WORKER}});
+    factory.addLink({5, 0.2, {1, sd::NodeType::WORKER}, {1, sd::NodeType::WORKER}});
+    factory.addLink({6, 0.8, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    factory.addLink({7, 0.5, {2, sd::NodeType::WORKER}, {3, sd::NodeType::WORKER}});
+    factory.addLink({8, 0.5, {2, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}});
+    factory.addLink({9, 1, {3, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}});
+    factory.addLink({10, 0.9, {4, sd::NodeType::WORKER}, {4, sd::NodeType::WORKER}});
+    factory.addLink({11, 0.1, {4, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+}
+
+inline void fillBoundedFactory(sd::Factory &factory)
+{
+    factory.addLoadingRamp({1, 1});
+    factory.addLoadingRamp({2, 4});
+    factory.addWorker({1, 3, sd::WorkerType::FIFO, 2});
+    factory.addWorker({2, 2, sd::WorkerType::LIFO, 3});
+    factory.addWorker({3, 5, sd::WorkerType::FIFO, 1});
+    factory.addStorehouse({1});
+    factory.addStorehouse({2, 40});
+    factory.addLink({1, 0.6, {1, sd::NodeType::RAMP}, {1, sd::NodeType::WORKER}});
+    factory.addLink({2, 0.4, {1, sd::NodeType::RAMP}, {2, sd::NodeType::WORKER}});
+    factory.addLink({3, 1, {2, sd::NodeType::RAMP}, {3, sd::NodeType::WORKER}});
+    factory.addLink({4, 0.5, {1, sd::NodeType::WORKER}, {3, sd::NodeType::WORKER}});
+    factory.addLink({5, 0.5, {1, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    factory.addLink({6, 0.7, {2, sd::NodeType::WORKER}, {3, sd::NodeType::WORKER}});
+    factory.addLink({7, 0.3, {2, sd::NodeType::WORKER}, {2, sd::NodeType::WORKER}});
+    factory.addLink({8, 0.2, {3, sd::NodeType::WORKER}, {1, sd::NodeType::STORE}});
+    factory.addLink({9, 0.8, {3, sd::NodeType::WORKER}, {2, sd::NodeType::STORE}});
+}
+
+inline std::string runRepetableSimulation(void (*fill)(sd::Factory &), size_t maxIterations,
+                                          const sd::Factory::RaportGuard &guard, const sd::RunOptions &options)
+{
+    resetRepetableSimulation();
+
+    sd::Factory factory;
+    fill(factory);
+
+    std::stringstream out;
+    factory.run(maxIterations, out, guard, options);
+    return out.str();
 }
\ No newline at end of file